@@ -8,6 +8,7 @@
 #include <chrono>
 #include <limits>      // for numeric_limits
 #include "Person.h"
+#include "Benchmark.h"
 
 using namespace std;
 
@@ -188,62 +189,69 @@ void saveStudentsToFile(const vector<Person>& students, const string& filename)
     }
 }
 
+// -----------------------------
+// Print one stage of the performance test
+// -----------------------------
+void printStageTime(const string& label, const BenchmarkStats& stats) {
+    cout << label << fixed << setprecision(3) << stats.medianMs() << " ms"
+         << "  (min " << stats.minMs() << ", MAD " << stats.madMs()
+         << ", p95 " << stats.p95Ms() << ")\n";
+    cout.unsetf(ios::floatfield);
+}
+
 // -----------------------------
 // Performance test (vector)
+// Every stage: 1 warm-up run, then the median of 5 timed
+// trials (Benchmark.h)
 // -----------------------------
 void runVectorPerformanceTest() {
     cout << "\n=== VECTOR PERFORMANCE TEST (v0.2) ===\n";
 
     // required sizes (you can uncomment 10 000 000 if your PC can handle it)
     vector<size_t> sizes = {1000, 10000, 100000, 1000000 /*, 10000000 */};
+    BenchmarkOptions bench(1, 5);
 
     for (size_t n : sizes) {
         cout << "\n--- Testing with " << n << " students ---\n";
 
         // 1) Generate random students
-        auto t_start_gen = chrono::high_resolution_clock::now();
-
+        vector<Person> generated;
+        BenchmarkStats genStats = runBenchmark(bench,
+            [&]() { generated = vector<Person>(); },
+            [&]() {
+                generated.reserve(n);
+                for (size_t i = 0; i < n; ++i) {
+                    Person p("Name" + to_string(i + 1),
+                             "Surname" + to_string(i + 1));
+                    generateRandomScores(p, 15);
+                    p.calculateFinalGradeAverage(); // use average
+                    generated.push_back(p);
+                }
+            });
+
+        // 2) Sort (every trial sorts a fresh copy)
         vector<Person> students;
-        students.reserve(n);
-
-        for (size_t i = 0; i < n; ++i) {
-            Person p("Name" + to_string(i + 1),
-                     "Surname" + to_string(i + 1));
-            generateRandomScores(p, 15);
-            p.calculateFinalGradeAverage(); // use average
-            students.push_back(p);
-        }
-
-        auto t_end_gen = chrono::high_resolution_clock::now();
-
-        // 2) Sort
-        auto t_start_sort = chrono::high_resolution_clock::now();
-        sort(students.begin(), students.end());
-        auto t_end_sort = chrono::high_resolution_clock::now();
+        BenchmarkStats sortStats = runBenchmark(bench,
+            [&]() { students = generated; },
+            [&]() { sort(students.begin(), students.end()); });
 
         // 3) Split into passed / failed
-        auto t_start_split = chrono::high_resolution_clock::now();
         vector<Person> passed, failed;
-        splitPassedFailed(students, passed, failed);
-        auto t_end_split = chrono::high_resolution_clock::now();
+        BenchmarkStats splitStats = runBenchmark(bench,
+            [&]() { passed = vector<Person>(); failed = vector<Person>(); },
+            [&]() { splitPassedFailed(students, passed, failed); });
 
         // 4) Write to files
-        auto t_start_write = chrono::high_resolution_clock::now();
         string base = "students_" + to_string(n);
-        saveStudentsToFile(passed, base + "_passed_vector.txt");
-        saveStudentsToFile(failed, base + "_failed_vector.txt");
-        auto t_end_write = chrono::high_resolution_clock::now();
-
-        // Calculate times in milliseconds
-        auto gen_ms   = chrono::duration_cast<chrono::milliseconds>(t_end_gen   - t_start_gen).count();
-        auto sort_ms  = chrono::duration_cast<chrono::milliseconds>(t_end_sort  - t_start_sort).count();
-        auto split_ms = chrono::duration_cast<chrono::milliseconds>(t_end_split - t_start_split).count();
-        auto write_ms = chrono::duration_cast<chrono::milliseconds>(t_end_write - t_start_write).count();
-
-        cout << "Generate: " << gen_ms  << " ms\n";
-        cout << "Sort:     " << sort_ms << " ms\n";
-        cout << "Split:    " << split_ms << " ms\n";
-        cout << "Write:    " << write_ms << " ms\n";
+        BenchmarkStats writeStats = runBenchmark(bench, [&]() {
+            saveStudentsToFile(passed, base + "_passed_vector.txt");
+            saveStudentsToFile(failed, base + "_failed_vector.txt");
+        });
+
+        printStageTime("Generate: ", genStats);
+        printStageTime("Sort:     ", sortStats);
+        printStageTime("Split:    ", splitStats);
+        printStageTime("Write:    ", writeStats);
         cout << "Passed: " << passed.size()
              << ", Failed: " << failed.size() << "\n";
     }
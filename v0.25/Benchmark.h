@@ -0,0 +1,187 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#elif defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX                 // keep std::numeric_limits<T>::max() usable
+#endif
+#include <windows.h>
+#endif
+
+// -----------------------------------------------
+// Benchmark harness
+//
+// runBenchmark(options, setup, work) calls
+//     setup(); work();
+// options.warmup times untimed, then options.trials times with
+// only work() timed on steady_clock in nanoseconds, and returns
+// min / median / MAD (median absolute deviation) / p95 of the
+// trials. setup() prepares each trial (e.g. a fresh copy of the
+// input) and is not timed. With pinCpu >= 0 the calling thread
+// runs on that CPU for the whole benchmark.
+//
+// doNotOptimize(value) makes the compiler assume "value" is
+// read, so work whose result is unused is not removed.
+// -----------------------------------------------
+struct BenchmarkOptions {
+    unsigned warmup;
+    unsigned trials;
+    int pinCpu;                  // -1 = do not pin
+
+    BenchmarkOptions(unsigned warmup = 1, unsigned trials = 5, int pinCpu = -1)
+        : warmup(warmup), trials(trials), pinCpu(pinCpu) {}
+};
+
+struct BenchmarkStats {
+    double minNs;
+    double medianNs;
+    double madNs;
+    double p95Ns;                // nearest rank
+    unsigned trials;
+
+    double minMs() const { return minNs / 1e6; }
+    double medianMs() const { return medianNs / 1e6; }
+    double madMs() const { return madNs / 1e6; }
+    double p95Ms() const { return p95Ns / 1e6; }
+};
+
+template <typename T>
+inline void doNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+inline void clobberMemory()
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#endif
+}
+
+namespace benchmarkDetail {
+
+inline double medianOfSorted(const std::vector<double>& sorted)
+{
+    std::size_t count = sorted.size();
+    return count % 2 != 0 ? sorted[count / 2]
+                          : (sorted[count / 2 - 1] + sorted[count / 2]) / 2.0;
+}
+
+// Pins the calling thread to one CPU and restores the
+// previous affinity on destruction (no-op if unsupported)
+class ThreadPin {
+private:
+#if defined(__linux__)
+    cpu_set_t previous;
+#elif defined(_WIN32)
+    DWORD_PTR previous;
+#endif
+    bool pinned;
+
+public:
+    explicit ThreadPin(int cpu) : pinned(false)
+    {
+        if (cpu < 0) return;
+#if defined(__linux__)
+        if (cpu >= CPU_SETSIZE) return;
+        if (pthread_getaffinity_np(pthread_self(), sizeof(previous), &previous) != 0) return;
+        cpu_set_t one;
+        CPU_ZERO(&one);
+        CPU_SET(cpu, &one);
+        pinned = pthread_setaffinity_np(pthread_self(), sizeof(one), &one) == 0;
+#elif defined(_WIN32)
+        if (cpu >= static_cast<int>(sizeof(DWORD_PTR) * 8)) return;
+        previous = SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu);
+        pinned = previous != 0;
+#endif
+    }
+
+    ~ThreadPin()
+    {
+        if (!pinned) return;
+#if defined(__linux__)
+        pthread_setaffinity_np(pthread_self(), sizeof(previous), &previous);
+#elif defined(_WIN32)
+        SetThreadAffinityMask(GetCurrentThread(), previous);
+#endif
+    }
+
+    bool isPinned() const { return pinned; }
+
+private:
+    ThreadPin(const ThreadPin&);
+    ThreadPin& operator=(const ThreadPin&);
+};
+
+} // namespace benchmarkDetail
+
+inline BenchmarkStats summarizeSamples(std::vector<double> ns)
+{
+    BenchmarkStats stats = {0.0, 0.0, 0.0, 0.0, static_cast<unsigned>(ns.size())};
+    if (ns.empty()) return stats;
+
+    std::sort(ns.begin(), ns.end());
+    stats.minNs = ns[0];
+    stats.medianNs = benchmarkDetail::medianOfSorted(ns);
+    stats.p95Ns = ns[(95 * ns.size() + 99) / 100 - 1];     // ceil(0.95 * count)
+
+    std::vector<double> deviations(ns.size());
+    for (std::size_t i = 0; i < ns.size(); ++i) {
+        deviations[i] = std::fabs(ns[i] - stats.medianNs);
+    }
+    std::sort(deviations.begin(), deviations.end());
+    stats.madNs = benchmarkDetail::medianOfSorted(deviations);
+    return stats;
+}
+
+template <typename Setup, typename Work>
+BenchmarkStats runBenchmark(const BenchmarkOptions& options, Setup setup, Work work)
+{
+    benchmarkDetail::ThreadPin pin(options.pinCpu);
+
+    for (unsigned i = 0; i < options.warmup; ++i) {
+        setup();
+        work();
+        clobberMemory();
+    }
+
+    std::vector<double> samples;
+    samples.reserve(options.trials);
+    for (unsigned i = 0; i < options.trials; ++i) {
+        setup();
+        clobberMemory();
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        work();
+        clobberMemory();
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        samples.push_back(static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+    }
+    return summarizeSamples(samples);
+}
+
+struct NoBenchmarkSetup {
+    void operator()() const {}
+};
+
+template <typename Work>
+BenchmarkStats runBenchmark(const BenchmarkOptions& options, Work work)
+{
+    return runBenchmark(options, NoBenchmarkSetup(), work);
+}
+
+#endif // BENCHMARK_H
@@ -5,10 +5,12 @@
 #include <deque>
 #include <algorithm>
 #include <chrono>
+#include <iomanip>
 #include <random>
 #include <stdexcept>
 #include <string>
 #include "Person.h"
+#include "Benchmark.h"
 
 using namespace std;
 
@@ -76,74 +78,78 @@ void writeStudentsToFile(const Container& students, const string& filename) {
     }
 }
 
+// --------------------------------------------------
+// Print one stage of the performance test
+// --------------------------------------------------
+void printStageTime(const string& label, const BenchmarkStats& stats) {
+    cout << label << fixed << setprecision(3) << stats.medianMs() << " ms"
+         << "  (min " << stats.minMs() << ", MAD " << stats.madMs()
+         << ", p95 " << stats.p95Ms() << ")\n";
+    cout.unsetf(ios::floatfield);
+}
+
 // --------------------------------------------------
 // Generic performance test for any container type
+// Every stage: 1 warm-up run, then the median of 5 timed
+// trials (Benchmark.h)
 // --------------------------------------------------
 template <typename Container>
 void runContainerTest(const string& label, const string& suffix) {
     cout << "\n=== " << label << " PERFORMANCE TEST ===\n";
 
     vector<size_t> sizes = {1000, 10000, 100000, 1000000};
+    BenchmarkOptions bench(1, 5);
 
     for (size_t n : sizes) {
         cout << "\n--- Testing with " << n << " students ---\n";
 
         // 1) Generate students
-        auto t_start_gen = chrono::high_resolution_clock::now();
-
+        Container generated;
+        BenchmarkStats genStats = runBenchmark(bench,
+            [&]() { generated = Container(); },
+            [&]() {
+                for (size_t i = 0; i < n; ++i) {
+                    Person p;
+                    fillRandomScores(p, static_cast<int>(i));
+                    generated.push_back(p);
+                }
+            });
+
+        // 2) Sort students (every trial sorts a fresh copy)
         Container students;
-
-        for (size_t i = 0; i < n; ++i) {
-            Person p;
-            fillRandomScores(p, static_cast<int>(i));
-            students.push_back(p);
-        }
-
-        auto t_end_gen = chrono::high_resolution_clock::now();
-
-        // 2) Sort students
-        auto t_start_sort = chrono::high_resolution_clock::now();
-        sortStudents(students);
-        auto t_end_sort = chrono::high_resolution_clock::now();
+        BenchmarkStats sortStats = runBenchmark(bench,
+            [&]() { students = generated; },
+            [&]() { sortStudents(students); });
 
         // 3) Split into passed / failed
-        auto t_start_split = chrono::high_resolution_clock::now();
-
         Container passed;
         Container failed;
-
-        for (const auto& s : students) {
-            if (s.getFinalGrade() >= 5.0) {
-                passed.push_back(s);
-            } else {
-                failed.push_back(s);
-            }
-        }
-
-        auto t_end_split = chrono::high_resolution_clock::now();
+        BenchmarkStats splitStats = runBenchmark(bench,
+            [&]() { passed = Container(); failed = Container(); },
+            [&]() {
+                for (const auto& s : students) {
+                    if (s.getFinalGrade() >= 5.0) {
+                        passed.push_back(s);
+                    } else {
+                        failed.push_back(s);
+                    }
+                }
+            });
 
         // 4) Write to files
-        auto t_start_write = chrono::high_resolution_clock::now();
-
         string base = to_string(n);
         string filePassed = "students_" + base + "_passed_" + suffix + ".txt";
         string fileFailed = "students_" + base + "_failed_" + suffix + ".txt";
 
-        writeStudentsToFile(passed, filePassed);
-        writeStudentsToFile(failed, fileFailed);
-
-        auto t_end_write = chrono::high_resolution_clock::now();
-
-        // Timing (ms)
-        auto gen_ms   = chrono::duration_cast<chrono::milliseconds>(t_end_gen   - t_start_gen).count();
-        auto sort_ms  = chrono::duration_cast<chrono::milliseconds>(t_end_sort  - t_start_sort).count();
-        auto split_ms = chrono::duration_cast<chrono::milliseconds>(t_end_split - t_start_split).count();
-        auto write_ms = chrono::duration_cast<chrono::milliseconds>(t_end_write - t_start_write).count();
+        BenchmarkStats writeStats = runBenchmark(bench, [&]() {
+            writeStudentsToFile(passed, filePassed);
+            writeStudentsToFile(failed, fileFailed);
+        });
 
-        cout << "Generate: " << gen_ms  << " ms\n";
-        cout << "Sort:     " << sort_ms << " ms\n";
-        cout << "Split:    " << split_ms << " ms\n";
-        cout << "Write:    " << write_ms << " ms\n";
+        printStageTime("Generate: ", genStats);
+        printStageTime("Sort:     ", sortStats);
+        printStageTime("Split:    ", splitStats);
+        printStageTime("Write:    ", writeStats);
         cout << "Passed:   " << passed.size()
              << ", Failed: " << failed.size() << "\n";
     }
@@ -0,0 +1,45 @@
+#include "Arena.h"
+
+#include <cstdint>
+#include <cstdlib>
+
+MonotonicArena::MonotonicArena(std::size_t chunkSize)
+    : cursor(NULL), limit(NULL), chunkSize(chunkSize), reserved(0) {}
+
+MonotonicArena::~MonotonicArena()
+{
+    release();
+}
+
+void* MonotonicArena::allocate(std::size_t bytes, std::size_t alignment)
+{
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(cursor);
+    std::uintptr_t aligned = (address + alignment - 1) & ~(std::uintptr_t)(alignment - 1);
+
+    if (cursor == NULL || aligned + bytes > reinterpret_cast<std::uintptr_t>(limit)) {
+        // New chunk; oversized requests get a chunk of their own
+        std::size_t size = bytes + alignment > chunkSize ? bytes + alignment : chunkSize;
+        char* chunk = static_cast<char*>(std::malloc(size));
+        if (chunk == NULL) throw std::bad_alloc();
+
+        chunks.push_back(chunk);
+        reserved += size;
+        cursor = chunk;
+        limit  = chunk + size;
+
+        address = reinterpret_cast<std::uintptr_t>(cursor);
+        aligned = (address + alignment - 1) & ~(std::uintptr_t)(alignment - 1);
+    }
+
+    cursor = reinterpret_cast<char*>(aligned + bytes);
+    return reinterpret_cast<void*>(aligned);
+}
+
+void MonotonicArena::release()
+{
+    for (std::size_t i = 0; i < chunks.size(); ++i) std::free(chunks[i]);
+    chunks.clear();
+    cursor = NULL;
+    limit = NULL;
+    reserved = 0;
+}
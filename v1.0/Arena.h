@@ -0,0 +1,90 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+// -----------------------------------------------
+// MonotonicArena – bump allocator for one benchmark run
+//
+// Memory is handed out from large chunks and never returned
+// individually; everything is freed in one shot when the arena
+// is released or destroyed. Not thread-safe: use one arena per
+// thread.
+// -----------------------------------------------
+class MonotonicArena {
+private:
+    std::vector<char*> chunks;
+    char* cursor;
+    char* limit;
+    std::size_t chunkSize;
+    std::size_t reserved;        // total bytes obtained from the heap
+
+public:
+    explicit MonotonicArena(std::size_t chunkSize = 16 * 1024 * 1024);
+    ~MonotonicArena();
+
+    void* allocate(std::size_t bytes, std::size_t alignment);
+    void release();              // free every chunk at once
+
+    std::size_t bytesReserved() const { return reserved; }
+
+private:
+    MonotonicArena(const MonotonicArena&);             // not copyable
+    MonotonicArena& operator=(const MonotonicArena&);
+};
+
+// -----------------------------------------------
+// ArenaAllocator<T> – standard allocator that takes its memory
+// from the arena it was given, or from the heap if that is NULL
+// (also the default). The arena is always passed explicitly and
+// copies of a container stay in the same arena. Deallocation
+// into an arena is a no-op. Objects using an arena must not
+// outlive it.
+// -----------------------------------------------
+template <typename T>
+class ArenaAllocator {
+public:
+    typedef T value_type;
+
+    // Moves and swaps take the arena along with the buffer
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+
+    MonotonicArena* arena;
+
+    ArenaAllocator() : arena(NULL) {}
+    explicit ArenaAllocator(MonotonicArena* arena) : arena(arena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+
+    T* allocate(std::size_t n)
+    {
+        if (arena != NULL) {
+            return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t)
+    {
+        if (arena == NULL) ::operator delete(p);
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b)
+{
+    return a.arena == b.arena;
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b)
+{
+    return a.arena != b.arena;
+}
+
+#endif // ARENA_H
@@ -0,0 +1,87 @@
+#ifndef ARENA_STUDENT_H
+#define ARENA_STUDENT_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Arena.h"
+#include "GradeKernels.h"
+#include "StudentGenerator.h"
+
+// -----------------------------------------------
+// ArenaStudent – generated student for the heap vs arena
+// benchmark (menu option 9)
+//
+// Person keeps std::allocator scores, so arena memory never
+// ends up in an ordinary Person. This type takes its score
+// array from the arena it is given (NULL = heap). The name
+// strings are outside the arena: they use std::allocator and
+// only avoid the heap because generated names fit the
+// std::string small buffer (longer names would allocate).
+// -----------------------------------------------
+struct ArenaStudent {
+    typedef std::vector<int, ArenaAllocator<int> > Scores;
+
+    std::string firstName;
+    std::string surname;
+    Scores homeworkScores;
+    int examScore;
+    double finalGrade;
+
+    explicit ArenaStudent(MonotonicArena* arena)
+        : homeworkScores(ArenaAllocator<int>(arena)), examScore(0), finalGrade(0.0) {}
+};
+
+// Student "index" with the same data and grade as fillRandomScores
+inline void fillArenaStudent(ArenaStudent& student, std::size_t index,
+                             const StudentGenerator& generator)
+{
+    student.firstName = "Name" + std::to_string(index + 1);
+    student.surname = "Surname" + std::to_string(index + 1);
+
+    StudentGenerator::Stream random = generator.stream(index);
+    student.homeworkScores.reserve(StudentGenerator::kHomeworkCount);
+    for (std::size_t k = 0; k < StudentGenerator::kHomeworkCount; ++k) {
+        student.homeworkScores.push_back(random.nextScore());
+    }
+    student.examScore = random.nextScore();
+    student.finalGrade = evaluateGrades(&student.homeworkScores[0],
+                                        student.homeworkScores.size(),
+                                        student.examScore).average;
+}
+
+namespace arenaDetail {
+
+template <typename Container>
+void reserveFor(Container&, std::size_t) {}
+
+template <typename T, typename A>
+void reserveFor(std::vector<T, A>& students, std::size_t count)
+{
+    students.reserve(count);
+}
+
+} // namespace arenaDetail
+
+// -----------------------------------------------
+// N students into a container of ArenaStudent with an
+// ArenaAllocator: container nodes and score arrays all come
+// from "arena" (or the heap if it is NULL). Single-threaded,
+// because a MonotonicArena is not thread-safe.
+// -----------------------------------------------
+template <typename Container>
+Container generateArenaStudents(std::size_t count, const StudentGenerator& generator,
+                                MonotonicArena* arena)
+{
+    Container students((typename Container::allocator_type(arena)));
+    arenaDetail::reserveFor(students, count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        students.emplace_back(arena);
+        fillArenaStudent(students.back(), i, generator);
+    }
+    return students;
+}
+
+#endif // ARENA_STUDENT_H
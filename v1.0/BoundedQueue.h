@@ -0,0 +1,67 @@
+#ifndef BOUNDED_QUEUE_H
+#define BOUNDED_QUEUE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+// -----------------------------------------------
+// BoundedQueue<T> – blocking FIFO between two pipeline stages
+//
+// push() waits while the queue holds "capacity" items, so a fast
+// producer can never run ahead of its consumer by more than that.
+// close() marks the end of the stream: pop() returns false once
+// the queue is closed and empty.
+// -----------------------------------------------
+template <typename T>
+class BoundedQueue {
+private:
+    std::deque<T> items;
+    std::size_t capacity;
+    bool closed;
+    std::mutex mutex;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+
+public:
+    explicit BoundedQueue(std::size_t capacity)
+        : capacity(capacity < 1 ? 1 : capacity), closed(false) {}
+
+    void push(T item)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (items.size() >= capacity && !closed) notFull.wait(lock);
+        if (closed) return;
+
+        items.push_back(std::move(item));
+        notEmpty.notify_one();
+    }
+
+    bool pop(T& item)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (items.empty() && !closed) notEmpty.wait(lock);
+        if (items.empty()) return false;
+
+        item = std::move(items.front());
+        items.pop_front();
+        notFull.notify_one();
+        return true;
+    }
+
+    void close()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+        notEmpty.notify_all();
+        notFull.notify_all();
+    }
+
+private:
+    BoundedQueue(const BoundedQueue&);
+    BoundedQueue& operator=(const BoundedQueue&);
+};
+
+#endif // BOUNDED_QUEUE_H
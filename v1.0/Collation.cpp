@@ -0,0 +1,77 @@
+#include "Collation.h"
+
+namespace {
+
+const std::size_t kMaxDigits = 255;
+
+inline bool isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+// [begin, end) is a digit run; skip leading zeros (keep one digit)
+// and limit the piece to kMaxDigits significant digits
+inline void numberPiece(const char* text, std::size_t& position, std::size_t length,
+                        std::size_t& first, std::size_t& digits)
+{
+    std::size_t end = position;
+    while (end < length && isDigit(text[end])) ++end;
+
+    first = position;
+    while (first + 1 < end && text[first] == '0') ++first;
+
+    digits = end - first;
+    if (digits > kMaxDigits) digits = kMaxDigits;
+    position = first + digits;
+}
+
+} // namespace
+
+void appendNaturalKey(std::string& key, const char* text, std::size_t length)
+{
+    std::size_t i = 0;
+    while (i < length) {
+        if (!isDigit(text[i])) {
+            key += text[i++];
+            continue;
+        }
+
+        std::size_t first = 0, digits = 0;
+        numberPiece(text, i, length, first, digits);
+        key += '0';
+        key += static_cast<char>(digits);
+        key.append(text + first, digits);
+    }
+}
+
+int naturalCompare(const char* a, std::size_t aLength,
+                   const char* b, std::size_t bLength)
+{
+    std::size_t i = 0, j = 0;
+    while (i < aLength && j < bLength) {
+        bool aNumber = isDigit(a[i]);
+        bool bNumber = isDigit(b[j]);
+
+        if (aNumber && bNumber) {
+            std::size_t aFirst = 0, aDigits = 0, bFirst = 0, bDigits = 0;
+            numberPiece(a, i, aLength, aFirst, aDigits);
+            numberPiece(b, j, bLength, bFirst, bDigits);
+            if (aDigits != bDigits) return aDigits < bDigits ? -1 : 1;
+            for (std::size_t k = 0; k < aDigits; ++k) {
+                if (a[aFirst + k] != b[bFirst + k]) return a[aFirst + k] < b[bFirst + k] ? -1 : 1;
+            }
+            continue;
+        }
+
+        // A number compares like the digit '0' against text
+        unsigned char aByte = aNumber ? '0' : static_cast<unsigned char>(a[i]);
+        unsigned char bByte = bNumber ? '0' : static_cast<unsigned char>(b[j]);
+        if (aByte != bByte) return aByte < bByte ? -1 : 1;
+        ++i;
+        ++j;
+    }
+
+    if (i < aLength) return 1;
+    if (j < bLength) return -1;
+    return 0;
+}
@@ -0,0 +1,35 @@
+#ifndef COLLATION_H
+#define COLLATION_H
+
+#include <cstddef>
+#include <string>
+
+// -----------------------------------------------
+// Natural (numeric-aware) order: "Name9" < "Name10"
+//
+// A name is split once into text and number pieces and encoded
+// as a key whose plain byte order (memcmp / std::string <) is
+// the natural order, so sorting never re-parses a name:
+//   text byte  -> itself
+//   number     -> '0', digit count (1 byte), digits without
+//                 leading zeros
+// A number sorts where a digit would among text bytes, and
+// longer numbers sort after shorter ones. Numbers longer than
+// 255 digits are cut into 255-digit pieces. Names that differ
+// only in leading zeros ("Name7" / "Name007") get equal keys.
+// -----------------------------------------------
+void appendNaturalKey(std::string& key, const char* text, std::size_t length);
+
+inline std::string naturalKey(const std::string& text)
+{
+    std::string key;
+    appendNaturalKey(key, text.data(), text.size());
+    return key;
+}
+
+// The same order computed directly on two names (no key):
+// < 0, 0 or > 0 like strcmp
+int naturalCompare(const char* a, std::size_t aLength,
+                   const char* b, std::size_t bLength);
+
+#endif // COLLATION_H
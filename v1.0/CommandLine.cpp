@@ -0,0 +1,212 @@
+#include "CommandLine.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+const char* const kContainers[] = {"vector", "list", "deque", "table"};
+const char* const kStrategies[] = {"1", "2", "3", "view", "parallel"};
+const char* const kFlags[] = {"--container", "--strategy", "--sizes", "--reps", "--warmup",
+                              "--seed", "--threads", "--pin", "--format"};
+
+template <std::size_t N>
+bool isOneOf(const std::string& value, const char* const (&names)[N])
+{
+    for (std::size_t i = 0; i < N; ++i) {
+        if (value == names[i]) return true;
+    }
+    return false;
+}
+
+std::vector<std::string> splitList(const std::string& value)
+{
+    std::vector<std::string> items;
+    std::stringstream in(value);
+    std::string item;
+    while (std::getline(in, item, ',')) {
+        if (!item.empty()) items.push_back(item);
+    }
+    return items;
+}
+
+uint64_t parseNumber(const std::string& flag, const std::string& value)
+{
+    if (value.empty() || value[0] == '-') {
+        throw std::runtime_error(flag + ": expected a non-negative number, got \"" + value + "\"");
+    }
+    char* end = NULL;
+    errno = 0;
+    unsigned long long number = std::strtoull(value.c_str(), &end, 10);
+    if (*end != '\0' || errno == ERANGE) {
+        throw std::runtime_error(flag + ": expected a non-negative number, got \"" + value + "\"");
+    }
+    return number;
+}
+
+// "all" or a list of names from "allowed"
+template <std::size_t N>
+std::vector<std::string> parseNames(const std::string& flag, const std::string& value,
+                                    const char* const (&allowed)[N], std::size_t allCount)
+{
+    if (value == "all") return std::vector<std::string>(allowed, allowed + allCount);
+
+    std::vector<std::string> names = splitList(value);
+    if (names.empty()) throw std::runtime_error(flag + ": empty list");
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        if (!isOneOf(names[i], allowed)) {
+            throw std::runtime_error(flag + ": unknown value \"" + names[i] + "\"");
+        }
+    }
+    return names;
+}
+
+std::string jsonString(const std::string& text)
+{
+    std::string quoted = "\"";
+    for (std::size_t i = 0; i < text.size(); ++i) {
+        if (text[i] == '"' || text[i] == '\\') quoted += '\\';
+        quoted += text[i];
+    }
+    return quoted + "\"";
+}
+
+} // namespace
+
+CommandLineOptions::CommandLineOptions()
+    : containers(kContainers, kContainers + 4),
+      strategies(kStrategies, kStrategies + 4),     // "parallel" only on request
+      reps(5), warmup(1), pinCpu(-1), seed(0), threads(1), format("csv"), help(false)
+{
+    sizes.push_back(1000);
+    sizes.push_back(10000);
+    sizes.push_back(100000);
+}
+
+// -----------------------------------------------
+// Parsing
+// -----------------------------------------------
+CommandLineOptions parseCommandLine(int argc, char* argv[])
+{
+    CommandLineOptions options;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string flag = argv[i];
+        if (flag == "--help" || flag == "-h") {
+            options.help = true;
+            continue;
+        }
+        if (flag.compare(0, 2, "--") != 0) {
+            throw std::runtime_error("unexpected argument \"" + flag + "\"");
+        }
+
+        std::string value;
+        std::size_t equals = flag.find('=');
+        bool joined = equals != std::string::npos;      // "--flag=value"
+        if (joined) {
+            value = flag.substr(equals + 1);
+            flag.erase(equals);
+        }
+        if (!isOneOf(flag, kFlags)) throw std::runtime_error("unknown flag \"" + flag + "\"");
+
+        if (!joined) {
+            if (i + 1 >= argc) throw std::runtime_error(flag + ": missing value");
+            value = argv[++i];
+        }
+
+        if (flag == "--container") {
+            options.containers = parseNames(flag, value, kContainers, 4);
+        } else if (flag == "--strategy") {
+            options.strategies = parseNames(flag, value, kStrategies, 4);
+        } else if (flag == "--sizes") {
+            std::vector<std::string> items = splitList(value);
+            if (items.empty()) throw std::runtime_error(flag + ": empty list");
+            options.sizes.clear();
+            for (std::size_t k = 0; k < items.size(); ++k) {
+                options.sizes.push_back(static_cast<std::size_t>(parseNumber(flag, items[k])));
+            }
+        } else if (flag == "--reps") {
+            options.reps = static_cast<unsigned>(parseNumber(flag, value));
+            if (options.reps == 0) throw std::runtime_error(flag + ": must be at least 1");
+        } else if (flag == "--warmup") {
+            options.warmup = static_cast<unsigned>(parseNumber(flag, value));
+        } else if (flag == "--pin") {
+            options.pinCpu = static_cast<int>(parseNumber(flag, value));
+        } else if (flag == "--seed") {
+            options.seed = parseNumber(flag, value);
+        } else if (flag == "--threads") {
+            options.threads = static_cast<unsigned>(parseNumber(flag, value));
+            if (options.threads == 0) throw std::runtime_error(flag + ": must be at least 1");
+        } else if (flag == "--format") {
+            if (value != "csv" && value != "json") {
+                throw std::runtime_error(flag + ": expected csv or json, got \"" + value + "\"");
+            }
+            options.format = value;
+        }
+    }
+
+    return options;
+}
+
+void printUsage(std::ostream& out, const char* program)
+{
+    out << "Usage: " << program << " [options]\n"
+        << "Without options the interactive menu is shown.\n\n"
+        << "  --container LIST   vector,list,deque,table or all (default all)\n"
+        << "  --strategy LIST    1,2,3,view,parallel or all = 1,2,3,view (default all)\n"
+        << "  --sizes LIST       student counts (default 1000,10000,100000)\n"
+        << "  --reps N           timed trials per cell (default 5)\n"
+        << "  --warmup N         untimed runs before the trials (default 1)\n"
+        << "  --seed N           generator seed (default random, printed in JSON)\n"
+        << "  --threads N        generation and parallel split threads (default 1)\n"
+        << "  --pin CPU          run the measuring thread on this CPU\n"
+        << "  --format F         csv or json (default csv)\n"
+        << "  --help             this text\n";
+}
+
+// -----------------------------------------------
+// Results
+// -----------------------------------------------
+void writeRowsCsv(std::ostream& out, const std::vector<BenchmarkRow>& rows)
+{
+    out << "n,stage,container,min_ms,median_ms,mad_ms,p95_ms,passed,failed\n";
+    out << std::fixed << std::setprecision(3);
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        const BenchmarkRow& row = rows[i];
+        out << row.n << ',' << row.stage << ',' << row.container << ','
+            << row.time.minMs() << ',' << row.time.medianMs() << ','
+            << row.time.madMs() << ',' << row.time.p95Ms() << ','
+            << row.passed << ',' << row.failed << '\n';
+    }
+    out.unsetf(std::ios::floatfield);
+}
+
+void writeRowsJson(std::ostream& out, const CommandLineOptions& options,
+                   const std::vector<BenchmarkRow>& rows)
+{
+    out << "{\n  \"seed\": " << options.seed
+        << ",\n  \"reps\": " << options.reps
+        << ",\n  \"warmup\": " << options.warmup
+        << ",\n  \"threads\": " << options.threads
+        << ",\n  \"rows\": [";
+    out << std::fixed << std::setprecision(3);
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        const BenchmarkRow& row = rows[i];
+        out << (i == 0 ? "\n" : ",\n")
+            << "    {\"n\": " << row.n
+            << ", \"stage\": " << jsonString(row.stage)
+            << ", \"container\": " << jsonString(row.container)
+            << ", \"min_ms\": " << row.time.minMs()
+            << ", \"median_ms\": " << row.time.medianMs()
+            << ", \"mad_ms\": " << row.time.madMs()
+            << ", \"p95_ms\": " << row.time.p95Ms()
+            << ", \"passed\": " << row.passed
+            << ", \"failed\": " << row.failed << "}";
+    }
+    out << (rows.empty() ? "]\n}\n" : "\n  ]\n}\n");
+    out.unsetf(std::ios::floatfield);
+}
@@ -0,0 +1,60 @@
+#ifndef COMMAND_LINE_H
+#define COMMAND_LINE_H
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "Benchmark.h"
+
+// -----------------------------------------------
+// Command-line benchmark mode
+//
+//   student_grading_v10 --container vector,list --strategy 1,3
+//                       --sizes 1000,100000 --reps 5 --warmup 1
+//                       --seed 42 --threads 4 --pin 0 --format json
+//
+// Every flag is optional ("--flag value" or "--flag=value");
+// lists are comma-separated. Without arguments the program
+// shows the interactive menu instead.
+// -----------------------------------------------
+struct CommandLineOptions {
+    std::vector<std::string> containers;   // vector, list, deque, table
+    std::vector<std::string> strategies;   // 1, 2, 3, view, parallel
+    std::vector<std::size_t> sizes;
+    unsigned reps;                         // timed trials per cell
+    unsigned warmup;                       // untimed runs before them
+    int pinCpu;                            // -1 = do not pin
+    uint64_t seed;                         // 0 = pick a random one
+    unsigned threads;                      // generation and parallel split
+    std::string format;                    // csv or json
+    bool help;
+
+    CommandLineOptions();
+};
+
+// Throws std::runtime_error on unknown flags or bad values
+CommandLineOptions parseCommandLine(int argc, char* argv[]);
+
+void printUsage(std::ostream& out, const char* program);
+
+// -----------------------------------------------
+// Result rows: one per (N, stage, container) cell,
+// with the harness statistics of its trials
+// -----------------------------------------------
+struct BenchmarkRow {
+    std::size_t n;
+    std::string stage;
+    std::string container;
+    BenchmarkStats time;
+    std::size_t passed;
+    std::size_t failed;
+};
+
+void writeRowsCsv(std::ostream& out, const std::vector<BenchmarkRow>& rows);
+void writeRowsJson(std::ostream& out, const CommandLineOptions& options,
+                   const std::vector<BenchmarkRow>& rows);
+
+#endif // COMMAND_LINE_H
@@ -0,0 +1,353 @@
+#include "GradeKernels.h"
+
+#include <algorithm>
+#include <vector>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define GRADE_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+// -----------------------------------------------
+// Scalar kernel (reference, works everywhere)
+// -----------------------------------------------
+namespace {
+
+inline int32_t rowSumScalar(const uint8_t* row, std::size_t homeworkCount)
+{
+    int32_t sum = 0;
+    for (std::size_t i = 0; i < homeworkCount; ++i) sum += row[i];
+    return sum;
+}
+
+void gradeScalar(const uint8_t* homework, const uint8_t* exam,
+                 std::size_t begin, std::size_t count,
+                 std::size_t homeworkCount, double* finalGrades)
+{
+    for (std::size_t i = begin; i < count; ++i) {
+        double sum = rowSumScalar(homework + i * homeworkCount, homeworkCount);
+        double average = sum / homeworkCount;
+        finalGrades[i] = 0.4 * average + 0.6 * exam[i];
+    }
+}
+
+} // namespace
+
+#ifdef GRADE_KERNELS_X86
+// -----------------------------------------------
+// SSE2 / AVX2 kernels
+// -----------------------------------------------
+namespace {
+
+// 16 x 0xFF followed by 16 x 0x00: loading at (16 - n) keeps n bytes
+const uint8_t kTailMask[32] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+// Sum of one homework row using psadbw. "limit" is the end of the
+// homework matrix; a 16-byte load never reads past it.
+__attribute__((target("sse2")))
+inline int32_t rowSumSSE2(const uint8_t* row, std::size_t homeworkCount,
+                          const uint8_t* limit)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = zero;
+    std::size_t i = 0;
+
+    for (; i + 16 <= homeworkCount; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i));
+        acc = _mm_add_epi64(acc, _mm_sad_epu8(v, zero));
+    }
+
+    int32_t tail = 0;
+    std::size_t rest = homeworkCount - i;
+    if (rest > 0) {
+        if (row + i + 16 <= limit) {
+            __m128i v    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i));
+            __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(kTailMask + 16 - rest));
+            acc = _mm_add_epi64(acc, _mm_sad_epu8(_mm_and_si128(v, mask), zero));
+        } else {
+            tail = rowSumScalar(row + i, rest);
+        }
+    }
+
+    return _mm_cvtsi128_si32(acc)
+         + _mm_cvtsi128_si32(_mm_unpackhi_epi64(acc, acc))
+         + tail;
+}
+
+__attribute__((target("sse2")))
+void gradeSSE2(const uint8_t* homework, const uint8_t* exam,
+               std::size_t count, std::size_t homeworkCount,
+               double* finalGrades)
+{
+    const uint8_t* limit = homework + count * homeworkCount;
+    const __m128d divisor = _mm_set1_pd(static_cast<double>(homeworkCount));
+    const __m128d wHomework = _mm_set1_pd(0.4);
+    const __m128d wExam     = _mm_set1_pd(0.6);
+
+    std::size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        const uint8_t* row = homework + i * homeworkCount;
+        __m128i sums = _mm_setr_epi32(rowSumSSE2(row, homeworkCount, limit),
+                                      rowSumSSE2(row + homeworkCount, homeworkCount, limit),
+                                      0, 0);
+        __m128i exams = _mm_setr_epi32(exam[i], exam[i + 1], 0, 0);
+
+        __m128d average = _mm_div_pd(_mm_cvtepi32_pd(sums), divisor);
+        __m128d grade   = _mm_add_pd(_mm_mul_pd(wHomework, average),
+                                     _mm_mul_pd(wExam, _mm_cvtepi32_pd(exams)));
+        _mm_storeu_pd(finalGrades + i, grade);
+    }
+
+    gradeScalar(homework, exam, i, count, homeworkCount, finalGrades);
+}
+
+__attribute__((target("avx2")))
+void gradeAVX2(const uint8_t* homework, const uint8_t* exam,
+               std::size_t count, std::size_t homeworkCount,
+               double* finalGrades)
+{
+    const uint8_t* limit = homework + count * homeworkCount;
+    const __m256d divisor = _mm256_set1_pd(static_cast<double>(homeworkCount));
+    const __m256d wHomework = _mm256_set1_pd(0.4);
+    const __m256d wExam     = _mm256_set1_pd(0.6);
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const uint8_t* row = homework + i * homeworkCount;
+        __m128i sums = _mm_setr_epi32(rowSumSSE2(row, homeworkCount, limit),
+                                      rowSumSSE2(row + homeworkCount, homeworkCount, limit),
+                                      rowSumSSE2(row + 2 * homeworkCount, homeworkCount, limit),
+                                      rowSumSSE2(row + 3 * homeworkCount, homeworkCount, limit));
+        __m128i exams = _mm_setr_epi32(exam[i], exam[i + 1], exam[i + 2], exam[i + 3]);
+
+        __m256d average = _mm256_div_pd(_mm256_cvtepi32_pd(sums), divisor);
+        __m256d grade   = _mm256_add_pd(_mm256_mul_pd(wHomework, average),
+                                        _mm256_mul_pd(wExam, _mm256_cvtepi32_pd(exams)));
+        _mm256_storeu_pd(finalGrades + i, grade);
+    }
+
+    gradeScalar(homework, exam, i, count, homeworkCount, finalGrades);
+}
+
+} // namespace
+#endif // GRADE_KERNELS_X86
+
+// -----------------------------------------------
+// Dispatch
+// -----------------------------------------------
+bool gradeKernelSupported(GradeKernel kernel)
+{
+    switch (kernel) {
+    case KernelScalar:
+        return true;
+#ifdef GRADE_KERNELS_X86
+    case KernelSSE2:
+        return __builtin_cpu_supports("sse2");
+    case KernelAVX2:
+        return __builtin_cpu_supports("avx2");
+#endif
+    default:
+        return false;
+    }
+}
+
+GradeKernel bestGradeKernel()
+{
+    static const GradeKernel best =
+        gradeKernelSupported(KernelAVX2) ? KernelAVX2 :
+        gradeKernelSupported(KernelSSE2) ? KernelSSE2 : KernelScalar;
+    return best;
+}
+
+const char* gradeKernelName(GradeKernel kernel)
+{
+    switch (kernel) {
+    case KernelSSE2: return "SSE2";
+    case KernelAVX2: return "AVX2";
+    default:         return "scalar";
+    }
+}
+
+void calculateFinalGradesAverage(const uint8_t* homework,
+                                 const uint8_t* exam,
+                                 std::size_t count,
+                                 std::size_t homeworkCount,
+                                 double* finalGrades)
+{
+    calculateFinalGradesAverage(homework, exam, count, homeworkCount,
+                                finalGrades, bestGradeKernel());
+}
+
+void calculateFinalGradesAverage(const uint8_t* homework,
+                                 const uint8_t* exam,
+                                 std::size_t count,
+                                 std::size_t homeworkCount,
+                                 double* finalGrades,
+                                 GradeKernel kernel)
+{
+    if (homeworkCount == 0) {
+        // Same special case as Person::calculateFinalGradeAverage
+        for (std::size_t i = 0; i < count; ++i) finalGrades[i] = 0.6 * exam[i];
+        return;
+    }
+
+    if (!gradeKernelSupported(kernel)) kernel = KernelScalar;
+
+    switch (kernel) {
+#ifdef GRADE_KERNELS_X86
+    case KernelAVX2:
+        gradeAVX2(homework, exam, count, homeworkCount, finalGrades);
+        break;
+    case KernelSSE2:
+        gradeSSE2(homework, exam, count, homeworkCount, finalGrades);
+        break;
+#endif
+    default:
+        gradeScalar(homework, exam, 0, count, homeworkCount, finalGrades);
+        break;
+    }
+}
+
+// -----------------------------------------------
+// Median engine
+// -----------------------------------------------
+namespace {
+
+const int kMaxScore = 10;
+const std::size_t kStackScores = 64;
+
+// Value at sorted position "k" given the histogram
+inline int histogramSelect(const uint32_t* counts, std::size_t k)
+{
+    std::size_t seen = 0;
+    for (int value = 0; value < kMaxScore; ++value) {
+        seen += counts[value];
+        if (k < seen) return value;
+    }
+    return kMaxScore;
+}
+
+// Median of arbitrary values via nth_element on a copy
+template <typename T>
+double selectMedian(T* values, std::size_t count)
+{
+    std::size_t upper = count / 2;
+    std::nth_element(values, values + upper, values + count);
+    int high = values[upper];
+    if (count % 2 != 0) return high;
+
+    int low = *std::max_element(values, values + upper);
+    return (low + high) / 2.0;
+}
+
+template <typename T>
+double fallbackMedian(const T* scores, std::size_t count)
+{
+    if (count <= kStackScores) {
+        T buffer[kStackScores];
+        std::copy(scores, scores + count, buffer);
+        return selectMedian(buffer, count);
+    }
+    std::vector<T> copy(scores, scores + count);
+    return selectMedian(&copy[0], count);
+}
+
+inline double medianFromHistogram(const uint32_t* counts, std::size_t count)
+{
+    int high = histogramSelect(counts, count / 2);
+    if (count % 2 != 0) return high;
+
+    int low = histogramSelect(counts, count / 2 - 1);
+    return (low + high) / 2.0;
+}
+
+template <typename T>
+double histogramMedian(const T* scores, std::size_t count)
+{
+    uint32_t counts[kMaxScore + 1] = {0};
+    for (std::size_t i = 0; i < count; ++i) {
+        // Negative ints wrap to huge unsigned values and fail too
+        unsigned value = static_cast<unsigned>(scores[i]);
+        if (value > static_cast<unsigned>(kMaxScore)) {
+            return fallbackMedian(scores, count);
+        }
+        ++counts[value];
+    }
+
+    return medianFromHistogram(counts, count);
+}
+
+} // namespace
+
+double medianScore(const int* scores, std::size_t count)
+{
+    return count == 0 ? 0.0 : histogramMedian(scores, count);
+}
+
+double medianScore(const uint8_t* scores, std::size_t count)
+{
+    return count == 0 ? 0.0 : histogramMedian(scores, count);
+}
+
+void calculateFinalGradesMedian(const uint8_t* homework,
+                                const uint8_t* exam,
+                                std::size_t count,
+                                std::size_t homeworkCount,
+                                double* finalGrades)
+{
+    if (homeworkCount == 0) {
+        // Same special case as Person::calculateFinalGradeMedian
+        for (std::size_t i = 0; i < count; ++i) finalGrades[i] = 0.6 * exam[i];
+        return;
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        double median = histogramMedian(homework + i * homeworkCount, homeworkCount);
+        finalGrades[i] = 0.4 * median + 0.6 * exam[i];
+    }
+}
+
+// -----------------------------------------------
+// Fused evaluation
+// -----------------------------------------------
+GradeResult evaluateGrades(const int* scores, std::size_t count, int examScore)
+{
+    GradeResult result;
+
+    if (count == 0) {
+        result.average = 0.6 * examScore;
+        result.median  = 0.6 * examScore;
+    } else {
+        // Sum (in double, like std::accumulate with 0.0) and histogram
+        // are filled in the same loop
+        uint32_t counts[kMaxScore + 1] = {0};
+        double sum = 0.0;
+        bool inRange = true;
+
+        for (std::size_t i = 0; i < count; ++i) {
+            int score = scores[i];
+            sum += score;
+            unsigned value = static_cast<unsigned>(score);
+            if (value <= static_cast<unsigned>(kMaxScore)) {
+                ++counts[value];
+            } else {
+                inRange = false;
+            }
+        }
+
+        double average = sum / count;
+        double median  = inRange ? medianFromHistogram(counts, count)
+                                 : fallbackMedian(scores, count);
+
+        result.average = 0.4 * average + 0.6 * examScore;
+        result.median  = 0.4 * median  + 0.6 * examScore;
+    }
+
+    result.passedAverage = result.average >= kPassThreshold;
+    result.passedMedian  = result.median  >= kPassThreshold;
+    return result;
+}
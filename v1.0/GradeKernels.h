@@ -0,0 +1,87 @@
+#ifndef GRADE_KERNELS_H
+#define GRADE_KERNELS_H
+
+#include <cstddef>
+#include <stdint.h>
+
+// -----------------------------------------------
+// Batch grading kernels
+//
+// Compute 0.4 * average(homework) + 0.6 * exam for a whole block
+// of students in one call. Homework scores are a row-major uint8
+// matrix with "homeworkCount" scores per student (StudentTable layout).
+//
+// Every kernel performs the same IEEE operations in the same order
+// as Person::calculateFinalGradeAverage (exact integer sum, one
+// division, two multiplications, one addition), so the results are
+// bit-for-bit identical to the scalar path. The build disables
+// floating-point contraction (-ffp-contract=off) to keep it that way.
+// -----------------------------------------------
+enum GradeKernel {
+    KernelScalar,
+    KernelSSE2,
+    KernelAVX2
+};
+
+// Fastest kernel supported by this CPU (detected once at runtime)
+GradeKernel bestGradeKernel();
+
+// True if "kernel" can run on this CPU
+bool gradeKernelSupported(GradeKernel kernel);
+
+const char* gradeKernelName(GradeKernel kernel);
+
+// Average-based final grades for "count" students, written to finalGrades.
+// Uses bestGradeKernel() unless a kernel is given explicitly.
+void calculateFinalGradesAverage(const uint8_t* homework,
+                                 const uint8_t* exam,
+                                 std::size_t count,
+                                 std::size_t homeworkCount,
+                                 double* finalGrades);
+
+void calculateFinalGradesAverage(const uint8_t* homework,
+                                 const uint8_t* exam,
+                                 std::size_t count,
+                                 std::size_t homeworkCount,
+                                 double* finalGrades,
+                                 GradeKernel kernel);
+
+// -----------------------------------------------
+// Median engine
+//
+// Scores are bounded integers (0..10), so the median comes from an
+// 11-bin histogram: one pass, no heap allocation, no comparison sort.
+// Out-of-range values fall back to std::nth_element on a copy
+// (a stack buffer for up to 64 scores).
+// The result matches Person's old copy + std::sort median exactly.
+// -----------------------------------------------
+double medianScore(const int* scores, std::size_t count);
+double medianScore(const uint8_t* scores, std::size_t count);
+
+// Median-based final grades (0.4 * median + 0.6 * exam) for "count"
+// students in the same row-major layout as above
+void calculateFinalGradesMedian(const uint8_t* homework,
+                                const uint8_t* exam,
+                                std::size_t count,
+                                std::size_t homeworkCount,
+                                double* finalGrades);
+
+// -----------------------------------------------
+// Fused evaluation
+//
+// One walk over the homework scores yields both final grades
+// (average and median method) and the pass/fail flag for each.
+// Grades are bit-identical to the separate calculations.
+// -----------------------------------------------
+const double kPassThreshold = 5.0;
+
+struct GradeResult {
+    double average;         // 0.4 * average(homework) + 0.6 * exam
+    double median;          // 0.4 * median(homework)  + 0.6 * exam
+    bool passedAverage;     // average >= kPassThreshold
+    bool passedMedian;      // median  >= kPassThreshold
+};
+
+GradeResult evaluateGrades(const int* scores, std::size_t count, int examScore);
+
+#endif // GRADE_KERNELS_H
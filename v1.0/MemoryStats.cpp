@@ -0,0 +1,153 @@
+#include "MemoryStats.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace {
+
+std::atomic<unsigned long long> allocations(0);
+std::atomic<unsigned long long> allocatedBytes(0);
+std::atomic<long long> liveBytes(0);
+std::atomic<long long> peakLiveBytes(0);
+
+// Every block starts with its size, so delete knows what it frees;
+// the header keeps the malloc alignment for the caller
+const std::size_t kHeader = alignof(std::max_align_t) > sizeof(std::size_t)
+                          ? alignof(std::max_align_t) : sizeof(std::size_t);
+
+void* countedAllocate(std::size_t size)
+{
+    char* block = static_cast<char*>(std::malloc(size + kHeader));
+    if (block == NULL) throw std::bad_alloc();
+    *reinterpret_cast<std::size_t*>(block) = size;
+
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    long long live = liveBytes.fetch_add(static_cast<long long>(size),
+                                         std::memory_order_relaxed) + static_cast<long long>(size);
+    long long peak = peakLiveBytes.load(std::memory_order_relaxed);
+    while (live > peak &&
+           !peakLiveBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+
+    return block + kHeader;
+}
+
+void countedFree(void* p)
+{
+    if (p == NULL) return;
+    char* block = static_cast<char*>(p) - kHeader;
+    std::size_t size = *reinterpret_cast<std::size_t*>(block);
+    liveBytes.fetch_sub(static_cast<long long>(size), std::memory_order_relaxed);
+    std::free(block);
+}
+
+} // namespace
+
+unsigned long long allocationCount()
+{
+    return allocations.load(std::memory_order_relaxed);
+}
+
+unsigned long long bytesAllocated()
+{
+    return allocatedBytes.load(std::memory_order_relaxed);
+}
+
+long long liveHeapBytes()
+{
+    return liveBytes.load(std::memory_order_relaxed);
+}
+
+long long peakHeapBytes()
+{
+    return peakLiveBytes.load(std::memory_order_relaxed);
+}
+
+void resetPeakHeap()
+{
+    peakLiveBytes.store(liveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+// -----------------------------------------------
+// /proc/self/status readers
+// -----------------------------------------------
+namespace {
+
+long readStatusKb(const char* field)
+{
+    std::FILE* f = std::fopen("/proc/self/status", "r");
+    if (f == NULL) return 0;
+
+    char line[256];
+    long value = 0;
+    std::size_t length = std::strlen(field);
+    while (std::fgets(line, sizeof(line), f) != NULL) {
+        if (std::strncmp(line, field, length) == 0 && line[length] == ':') {
+            value = std::strtol(line + length + 1, NULL, 10);
+            break;
+        }
+    }
+    std::fclose(f);
+    return value;
+}
+
+} // namespace
+
+long currentRssKb()
+{
+    return readStatusKb("VmRSS");
+}
+
+long peakRssKb()
+{
+    return readStatusKb("VmHWM");
+}
+
+bool resetPeakRss()
+{
+    std::FILE* f = std::fopen("/proc/self/clear_refs", "w");
+    if (f == NULL) return false;
+
+    bool ok = std::fputs("5", f) >= 0;
+    return std::fclose(f) == 0 && ok;
+}
+
+// -----------------------------------------------
+// Global replacements
+// -----------------------------------------------
+void* operator new(std::size_t size)
+{
+    return countedAllocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return countedAllocate(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    countedFree(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    countedFree(p);
+}
+
+#if defined(__cpp_sized_deallocation)
+void operator delete(void* p, std::size_t) noexcept
+{
+    countedFree(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    countedFree(p);
+}
+#endif
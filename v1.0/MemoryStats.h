@@ -0,0 +1,37 @@
+#ifndef MEMORY_STATS_H
+#define MEMORY_STATS_H
+
+// -----------------------------------------------
+// Heap allocation counter
+//
+// MemoryStats.cpp replaces the global operator new / delete
+// with versions that count every allocation and its bytes
+// (thread-safe).
+// Take the count before and after a piece of work to see
+// how many allocations it made.
+// -----------------------------------------------
+unsigned long long allocationCount();
+
+// -----------------------------------------------
+// Heap byte counters (same hooks; sizes as requested
+// from operator new, without malloc overhead)
+// -----------------------------------------------
+unsigned long long bytesAllocated();   // total ever allocated
+long long liveHeapBytes();             // allocated and not yet freed
+long long peakHeapBytes();             // high-water mark of liveHeapBytes
+
+// Restart the heap high-water mark from the current live bytes
+void resetPeakHeap();
+
+// -----------------------------------------------
+// Resident set size (Linux /proc/self/status, 0 elsewhere)
+// -----------------------------------------------
+long currentRssKb();     // VmRSS
+long peakRssKb();        // VmHWM – high-water mark
+
+// Restart the high-water mark from the current RSS
+// (writes "5" to /proc/self/clear_refs). Returns false if
+// the kernel does not allow it; the peak is then process-wide.
+bool resetPeakRss();
+
+#endif // MEMORY_STATS_H
@@ -0,0 +1,53 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+// -----------------------------------------------
+// parallelFor – split [0, count) into "parts" contiguous
+// ranges of (almost) equal size and call
+//     f(begin, end, part)
+// for each of them, one range per thread. Part 0 runs on
+// the calling thread. The first exception thrown by any
+// part is rethrown after all threads have joined.
+// -----------------------------------------------
+template <typename Func>
+void parallelFor(std::size_t count, unsigned parts, Func f)
+{
+    if (parts <= 1 || count <= 1) {
+        f(std::size_t(0), count, 0u);
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(parts);
+    std::vector<std::thread> workers;
+    workers.reserve(parts - 1);
+
+    for (unsigned part = 1; part < parts; ++part) {
+        std::size_t begin = count * part / parts;
+        std::size_t end   = count * (part + 1) / parts;
+        workers.push_back(std::thread([&f, &errors, begin, end, part]() {
+            try {
+                f(begin, end, part);
+            } catch (...) {
+                errors[part] = std::current_exception();
+            }
+        }));
+    }
+
+    try {
+        f(std::size_t(0), count / parts, 0u);
+    } catch (...) {
+        errors[0] = std::current_exception();
+    }
+
+    for (std::size_t i = 0; i < workers.size(); ++i) workers[i].join();
+    for (unsigned part = 0; part < parts; ++part) {
+        if (errors[part]) std::rethrow_exception(errors[part]);
+    }
+}
+
+#endif // PARALLEL_H
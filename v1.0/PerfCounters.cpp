@@ -0,0 +1,152 @@
+#include "PerfCounters.h"
+
+#include <cstring>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+const char* perfEventName(PerfEvent event)
+{
+    switch (event) {
+    case PerfCycles:       return "cycles";
+    case PerfInstructions: return "instructions";
+    case PerfCacheMisses:  return "cache-misses";
+    case PerfBranchMisses: return "branch-misses";
+    case PerfPageFaults:   return "page-faults";
+    default:               return "?";
+    }
+}
+
+#if defined(__linux__)
+namespace {
+
+int openEvent(PerfEvent event)
+{
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.disabled = 1;
+    attr.inherit = 1;              // include threads started later
+    attr.exclude_kernel = 1;       // allowed with perf_event_paranoid <= 2
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    switch (event) {
+    case PerfCycles:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CPU_CYCLES;
+        break;
+    case PerfInstructions:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+        break;
+    case PerfCacheMisses:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        break;
+    case PerfBranchMisses:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+        break;
+    default:
+        attr.type = PERF_TYPE_SOFTWARE;
+        attr.config = PERF_COUNT_SW_PAGE_FAULTS;
+        break;
+    }
+
+    // pid 0 = this process, cpu -1 = any CPU
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+} // namespace
+
+PerfCounters::PerfCounters()
+{
+    for (int e = 0; e < kPerfEventCount; ++e) {
+        fds[e] = openEvent(static_cast<PerfEvent>(e));
+        if (fds[e] < 0 && reason.empty()) {
+            reason = std::string(perfEventName(static_cast<PerfEvent>(e))) + ": "
+                   + std::strerror(errno);
+        }
+    }
+}
+
+PerfCounters::~PerfCounters()
+{
+    for (int e = 0; e < kPerfEventCount; ++e) {
+        if (fds[e] >= 0) close(fds[e]);
+    }
+}
+
+void PerfCounters::start()
+{
+    for (int e = 0; e < kPerfEventCount; ++e) {
+        if (fds[e] < 0) continue;
+        ioctl(fds[e], PERF_EVENT_IOC_RESET, 0);
+        ioctl(fds[e], PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+void PerfCounters::stop()
+{
+    for (int e = 0; e < kPerfEventCount; ++e) {
+        if (fds[e] >= 0) ioctl(fds[e], PERF_EVENT_IOC_DISABLE, 0);
+    }
+}
+
+PerfSample PerfCounters::read() const
+{
+    PerfSample sample;
+    for (int e = 0; e < kPerfEventCount; ++e) {
+        sample.value[e] = 0;
+        sample.valid[e] = false;
+        if (fds[e] < 0) continue;
+
+        uint64_t data[3];          // value, time enabled, time running
+        if (::read(fds[e], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data))) continue;
+        if (data[2] == 0) continue;    // never got onto the PMU
+
+        // Counter shared the PMU with others: extrapolate
+        sample.value[e] = data[2] < data[1]
+                        ? static_cast<uint64_t>(double(data[0]) * data[1] / data[2])
+                        : data[0];
+        sample.valid[e] = true;
+    }
+    return sample;
+}
+
+#else // !__linux__
+
+PerfCounters::PerfCounters() : reason("perf_event_open is Linux only")
+{
+    for (int e = 0; e < kPerfEventCount; ++e) fds[e] = -1;
+}
+
+PerfCounters::~PerfCounters() {}
+void PerfCounters::start() {}
+void PerfCounters::stop() {}
+
+PerfSample PerfCounters::read() const
+{
+    PerfSample sample;
+    for (int e = 0; e < kPerfEventCount; ++e) {
+        sample.value[e] = 0;
+        sample.valid[e] = false;
+    }
+    return sample;
+}
+
+#endif // __linux__
+
+bool PerfCounters::available() const
+{
+    for (int e = 0; e < kPerfEventCount; ++e) {
+        if (fds[e] >= 0) return true;
+    }
+    return false;
+}
@@ -0,0 +1,57 @@
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <string>
+#include <stdint.h>
+
+// -----------------------------------------------
+// Hardware / software event counters (Linux perf_event_open)
+//
+// Each event is opened on its own for the calling process
+// (user space only, threads created later included), so one
+// missing event does not take the others down. Counters the
+// kernel, the CPU or the sandbox does not offer are simply
+// unavailable: start()/stop() still work and read() marks
+// them invalid. On other systems nothing is available.
+// -----------------------------------------------
+enum PerfEvent {
+    PerfCycles,
+    PerfInstructions,
+    PerfCacheMisses,
+    PerfBranchMisses,
+    PerfPageFaults,
+    kPerfEventCount
+};
+
+const char* perfEventName(PerfEvent event);
+
+struct PerfSample {
+    uint64_t value[kPerfEventCount];   // scaled if the counter was multiplexed
+    bool valid[kPerfEventCount];
+
+    bool has(PerfEvent event) const { return valid[event]; }
+};
+
+class PerfCounters {
+private:
+    int fds[kPerfEventCount];          // -1 = not available
+    std::string reason;                // why the first event failed
+
+public:
+    PerfCounters();
+    ~PerfCounters();
+
+    bool available() const;            // at least one event open
+    bool has(PerfEvent event) const { return fds[event] >= 0; }
+    const std::string& unavailableReason() const { return reason; }
+
+    void start();                      // reset + enable
+    void stop();                       // disable
+    PerfSample read() const;
+
+private:
+    PerfCounters(const PerfCounters&);             // not copyable
+    PerfCounters& operator=(const PerfCounters&);
+};
+
+#endif // PERF_COUNTERS_H
@@ -1,26 +1,52 @@
 
 #include "Person.h"
+#include "GradeKernels.h"
+#include "Collation.h"
 #include <algorithm>
 #include <numeric>
 #include <iomanip>
 
 // Default constructor
 Person::Person()
-    : firstName(""), surname(""), examScore(0), finalGrade(0.0) {}
+    : firstName(""), surname(""), examScore(0), finalGrade(0.0),
+      finalGradeAverage(0.0), finalGradeMedian(0.0),
+      passedAverage(false), passedMedian(false) {}
 
 // Parameterized constructor
-Person::Person(const std::string& firstName, const std::string& surname)
-    : firstName(firstName), surname(surname), examScore(0), finalGrade(0.0) {}
+Person::Person(std::string firstName, std::string surname)
+    : firstName(std::move(firstName)), surname(std::move(surname)),
+      examScore(0), finalGrade(0.0),
+      finalGradeAverage(0.0), finalGradeMedian(0.0),
+      passedAverage(false), passedMedian(false) {}
 
-// Copy constructor (Rule of Three)
+// Copy constructor (Rule of Five)
 Person::Person(const Person& other)
     : firstName(other.firstName),
       surname(other.surname),
       homeworkScores(other.homeworkScores),
       examScore(other.examScore),
-      finalGrade(other.finalGrade) {}
-
-// Assignment operator (Rule of Three)
+      finalGrade(other.finalGrade),
+      finalGradeAverage(other.finalGradeAverage),
+      finalGradeMedian(other.finalGradeMedian),
+      passedAverage(other.passedAverage),
+      passedMedian(other.passedMedian),
+      naturalKey(other.naturalKey) {}
+
+// Move constructor (Rule of Five) – steals the strings and the
+// score buffer, so containers relocate students without allocating
+Person::Person(Person&& other) noexcept
+    : firstName(std::move(other.firstName)),
+      surname(std::move(other.surname)),
+      homeworkScores(std::move(other.homeworkScores)),
+      examScore(other.examScore),
+      finalGrade(other.finalGrade),
+      finalGradeAverage(other.finalGradeAverage),
+      finalGradeMedian(other.finalGradeMedian),
+      passedAverage(other.passedAverage),
+      passedMedian(other.passedMedian),
+      naturalKey(std::move(other.naturalKey)) {}
+
+// Copy assignment (Rule of Five)
 Person& Person::operator=(const Person& other) {
     if (this != &other) {
         firstName       = other.firstName;
@@ -28,11 +54,33 @@ Person& Person::operator=(const Person& other) {
         homeworkScores  = other.homeworkScores;
         examScore       = other.examScore;
         finalGrade      = other.finalGrade;
+        finalGradeAverage = other.finalGradeAverage;
+        finalGradeMedian  = other.finalGradeMedian;
+        passedAverage   = other.passedAverage;
+        passedMedian    = other.passedMedian;
+        naturalKey      = other.naturalKey;
+    }
+    return *this;
+}
+
+// Move assignment (Rule of Five)
+Person& Person::operator=(Person&& other) noexcept {
+    if (this != &other) {
+        firstName       = std::move(other.firstName);
+        surname         = std::move(other.surname);
+        homeworkScores  = std::move(other.homeworkScores);
+        examScore       = other.examScore;
+        finalGrade      = other.finalGrade;
+        finalGradeAverage = other.finalGradeAverage;
+        finalGradeMedian  = other.finalGradeMedian;
+        passedAverage   = other.passedAverage;
+        passedMedian    = other.passedMedian;
+        naturalKey      = std::move(other.naturalKey);
     }
     return *this;
 }
 
-// Destructor (Rule of Three)
+// Destructor (Rule of Five)
 Person::~Person() {
     // std::vector cleans itself – nothing to do
 }
@@ -41,39 +89,48 @@ Person::~Person() {
 void Person::calculateFinalGradeAverage() {
     if (homeworkScores.empty()) {
         finalGrade = 0.6 * examScore;
-        return;
+    } else {
+        double sum = std::accumulate(homeworkScores.begin(),
+                                     homeworkScores.end(), 0.0);
+        double average = sum / homeworkScores.size();
+        finalGrade = 0.4 * average + 0.6 * examScore;
     }
 
-    double sum = std::accumulate(homeworkScores.begin(),
-                                 homeworkScores.end(), 0.0);
-    double average = sum / homeworkScores.size();
-    finalGrade = 0.4 * average + 0.6 * examScore;
+    finalGradeAverage = finalGrade;
+    passedAverage     = finalGrade >= kPassThreshold;
 }
 
 // Calculate final grade using median of homework
 void Person::calculateFinalGradeMedian() {
     if (homeworkScores.empty()) {
         finalGrade = 0.6 * examScore;
-        return;
-    }
-
-    std::vector<int> sortedScores = homeworkScores;
-    std::sort(sortedScores.begin(), sortedScores.end());
-
-    double median;
-    std::size_t size = sortedScores.size();
-    if (size % 2 == 0) {
-        median = (sortedScores[size / 2 - 1] + sortedScores[size / 2]) / 2.0;
     } else {
-        median = sortedScores[size / 2];
+        // Histogram median: no copy, no sort
+        double median = medianScore(&homeworkScores[0], homeworkScores.size());
+        finalGrade = 0.4 * median + 0.6 * examScore;
     }
 
-    finalGrade = 0.4 * median + 0.6 * examScore;
+    finalGradeMedian = finalGrade;
+    passedMedian     = finalGrade >= kPassThreshold;
+}
+
+// Calculate both grades (and pass flags) in a single pass
+void Person::calculateFinalGrades() {
+    GradeResult result = evaluateGrades(
+        homeworkScores.empty() ? NULL : &homeworkScores[0],
+        homeworkScores.size(), examScore);
+
+    finalGradeAverage = result.average;
+    finalGradeMedian  = result.median;
+    passedAverage     = result.passedAverage;
+    passedMedian      = result.passedMedian;
+    finalGrade        = result.average;
 }
 
 // Input operator for manual input
 std::istream& operator>>(std::istream& is, Person& person) {
     person.homeworkScores.clear();
+    person.naturalKey.clear();      // names change below
 
     std::cout << "Enter first name: ";
     is >> person.firstName;
@@ -111,6 +168,15 @@ std::ostream& operator<<(std::ostream& os, const Person& person) {
     return os;
 }
 
+// Natural-order key: surname key, 0 byte, first name key
+void Person::buildNaturalKey() {
+    naturalKey.clear();
+    naturalKey.reserve(surname.size() + firstName.size() + 8);
+    appendNaturalKey(naturalKey, surname.data(), surname.size());
+    naturalKey += '\0';
+    appendNaturalKey(naturalKey, firstName.data(), firstName.size());
+}
+
 // Comparison operator for sorting students alphabetically
 bool Person::operator<(const Person& other) const {
     if (surname != other.surname)
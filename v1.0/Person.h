@@ -5,42 +5,72 @@
 #include <string>
 #include <vector>
 #include <iostream>
+#include <utility>
 
 class Person {
+public:
+    typedef std::vector<int> HomeworkScores;
+
 private:
     std::string firstName;
     std::string surname;
-    std::vector<int> homeworkScores;
+    HomeworkScores homeworkScores;
     int examScore;
-    double finalGrade;
+    double finalGrade;          // result of the last calculation
+    double finalGradeAverage;   // stored by calculateFinalGradeAverage / calculateFinalGrades
+    double finalGradeMedian;    // stored by calculateFinalGradeMedian  / calculateFinalGrades
+    bool passedAverage;
+    bool passedMedian;
+    std::string naturalKey;     // natural-order collation key (empty until built)
 
 public:
     // Constructors
     Person();
-    Person(const std::string& firstName, const std::string& surname);
+    Person(std::string firstName, std::string surname);
 
-    // Rule of Three
+    // Rule of Five
     Person(const Person& other);                 // Copy constructor
-    Person& operator=(const Person& other);      // Assignment operator
+    Person(Person&& other) noexcept;             // Move constructor
+    Person& operator=(const Person& other);      // Copy assignment
+    Person& operator=(Person&& other) noexcept;  // Move assignment
     ~Person();                                   // Destructor
 
-    // Getters
-    std::string getFirstName() const { return firstName; }
-    std::string getSurname() const { return surname; }
+    // Getters (no copies)
+    const std::string& getFirstName() const { return firstName; }
+    const std::string& getSurname() const { return surname; }
     double getFinalGrade() const { return finalGrade; }
-    const std::vector<int>& getHomeworkScores() const { return homeworkScores; }
+    double getFinalGradeAverage() const { return finalGradeAverage; }
+    double getFinalGradeMedian() const { return finalGradeMedian; }
+    // Pass flags as of the last calculate call (false before any)
+    bool isPassedAverage() const { return passedAverage; }
+    bool isPassedMedian() const { return passedMedian; }
+    const HomeworkScores& getHomeworkScores() const { return homeworkScores; }
     int getExamScore() const { return examScore; }
+    const std::string& getNaturalKey() const { return naturalKey; }
 
-    // Setters
-    void setFirstName(const std::string& name) { firstName = name; }
-    void setSurname(const std::string& name) { surname = name; }
+    // Setters (name setters clear the natural key; a natural sort rebuilds it)
+    void setFirstName(const std::string& name) { firstName = name; naturalKey.clear(); }
+    void setSurname(const std::string& name) { surname = name; naturalKey.clear(); }
+    void setFirstName(std::string&& name) { firstName = std::move(name); naturalKey.clear(); }
+    void setSurname(std::string&& name) { surname = std::move(name); naturalKey.clear(); }
+    void setFirstName(const char* name, std::size_t length) { firstName.assign(name, length); naturalKey.clear(); }
+    void setSurname(const char* name, std::size_t length) { surname.assign(name, length); naturalKey.clear(); }
+    void reserveHomeworkScores(std::size_t count) { homeworkScores.reserve(count); }
     void addHomeworkScore(int score) { homeworkScores.push_back(score); }
     void setExamScore(int score) { examScore = score; }
     void setHomeworkScores(const std::vector<int>& scores) { homeworkScores = scores; }
+    void setHomeworkScores(std::vector<int>&& scores) { homeworkScores = std::move(scores); }
 
     // Calculation methods
     void calculateFinalGradeAverage();
     void calculateFinalGradeMedian();
+    // Fused: one pass computes both grades and both pass flags
+    // (finalGrade is set to the average result)
+    void calculateFinalGrades();
+
+    // Natural-order key for "surname, first name" (see Collation.h).
+    // Built once after the names are set; sorting compares only keys.
+    void buildNaturalKey();
 
     // I/O operators
     friend std::istream& operator>>(std::istream& is, Person& person);
@@ -0,0 +1,280 @@
+#include "Pipeline.h"
+
+#include <chrono>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include "StudentFile.h"
+
+namespace {
+
+typedef std::vector<Person> Batch;
+typedef std::chrono::steady_clock PipelineClock;
+
+double secondsSince(PipelineClock::time_point start)
+{
+    return std::chrono::duration<double>(PipelineClock::now() - start).count();
+}
+
+// First error raised by the source or grade stage; closing
+// the queue lets the other side run to the end instead of
+// blocking forever
+class PipelineErrors {
+private:
+    std::mutex mutex;
+    std::exception_ptr first;
+    BoundedQueue<Batch>& queue;
+
+public:
+    explicit PipelineErrors(BoundedQueue<Batch>& queue) : queue(queue) {}
+
+    void record(std::exception_ptr error)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!first) first = error;
+        }
+        queue.close();
+    }
+
+    void rethrow()
+    {
+        if (first) std::rethrow_exception(first);
+    }
+};
+
+void gradeStage(BoundedQueue<Batch>& input,
+                AsyncStudentWriter& passedOut, AsyncStudentWriter& failedOut,
+                StageStats& stats, PipelineResult& result, PipelineErrors& errors)
+{
+    try {
+        Batch batch;
+        while (input.pop(batch)) {
+            PipelineClock::time_point start = PipelineClock::now();
+
+            Batch passed, failed;
+            passed.reserve(batch.size());
+            failed.reserve(batch.size());
+            for (std::size_t i = 0; i < batch.size(); ++i) {
+                batch[i].calculateFinalGrades();
+                if (batch[i].isPassedAverage()) passed.push_back(std::move(batch[i]));
+                else                            failed.push_back(std::move(batch[i]));
+            }
+            result.passed += passed.size();
+            result.failed += failed.size();
+            stats.students += batch.size();
+            stats.busySeconds += secondsSince(start);
+
+            if (!passed.empty()) passedOut.push(std::move(passed));
+            if (!failed.empty()) failedOut.push(std::move(failed));
+        }
+    } catch (...) {
+        errors.record(std::current_exception());
+    }
+}
+
+// Runs the stages; "source(batch)" fills the next batch and
+// returns false when the input is exhausted
+template <typename Source>
+PipelineResult runPipeline(Source source, const std::string& sourceName,
+                           const std::string& passedFile,
+                           const std::string& failedFile,
+                           const PipelineOptions& options)
+{
+    PipelineClock::time_point wallStart = PipelineClock::now();
+
+    BoundedQueue<Batch> toGrade(options.queueCapacity);
+    PipelineErrors errors(toGrade);
+
+    PipelineResult result;
+    result.passed = 0;
+    result.failed = 0;
+    result.stages.resize(2);
+    result.stages[0].name = sourceName;
+    result.stages[1].name = "Grade + split";
+    for (std::size_t i = 0; i < result.stages.size(); ++i) {
+        result.stages[i].students = 0;
+        result.stages[i].busySeconds = 0.0;
+    }
+
+    AsyncStudentWriter passedWriter(passedFile, "Write passed", options.queueCapacity);
+    AsyncStudentWriter failedWriter(failedFile, "Write failed", options.queueCapacity);
+
+    std::thread grader(gradeStage, std::ref(toGrade), std::ref(passedWriter),
+                       std::ref(failedWriter), std::ref(result.stages[1]),
+                       std::ref(result), std::ref(errors));
+
+    // The source stage runs on the calling thread
+    try {
+        StageStats& stats = result.stages[0];
+        for (;;) {
+            PipelineClock::time_point start = PipelineClock::now();
+            Batch batch;
+            batch.reserve(options.batchSize);
+            bool more = source(batch);
+            stats.students += batch.size();
+            stats.busySeconds += secondsSince(start);
+
+            if (!batch.empty()) toGrade.push(std::move(batch));
+            if (!more) break;
+        }
+    } catch (...) {
+        errors.record(std::current_exception());
+    }
+    toGrade.close();
+
+    grader.join();
+    errors.rethrow();
+
+    passedWriter.finish();
+    failedWriter.finish();
+    result.stages.push_back(passedWriter.stats());
+    result.stages.push_back(failedWriter.stats());
+
+    result.wallSeconds = secondsSince(wallStart);
+    return result;
+}
+
+// Source: generated students [next, count)
+class GenerateSource {
+private:
+    std::size_t next;
+    std::size_t count;
+    std::size_t batchSize;
+    const StudentGenerator* generator;
+
+public:
+    GenerateSource(std::size_t count, std::size_t batchSize,
+                   const StudentGenerator& generator)
+        : next(0), count(count), batchSize(batchSize), generator(&generator) {}
+
+    bool operator()(Batch& batch)
+    {
+        std::size_t end = next + batchSize < count ? next + batchSize : count;
+        batch.resize(end - next);
+        for (std::size_t i = next; i < end; ++i) {
+            fillRandomStudent(batch[i - next], i, *generator);
+        }
+        next = end;
+        return next < count;
+    }
+};
+
+// Source: rows of a mapped file, batchSize lines at a time
+class FileSource {
+private:
+    const char* cursor;
+    const char* end;
+    std::size_t batchSize;
+
+public:
+    FileSource(const MappedFile& file, std::size_t batchSize)
+        : cursor(file.data()), end(file.data() + file.size()), batchSize(batchSize)
+    {
+        // Skip header
+        const char* body = static_cast<const char*>(std::memchr(cursor, '\n', file.size()));
+        cursor = (body == NULL) ? end : body + 1;
+    }
+
+    bool operator()(Batch& batch)
+    {
+        const char* stop = cursor;
+        for (std::size_t lines = 0; lines < batchSize && stop < end; ++lines) {
+            const char* nl = static_cast<const char*>(
+                std::memchr(stop, '\n', static_cast<std::size_t>(end - stop)));
+            stop = (nl == NULL) ? end : nl + 1;
+        }
+        parseStudentRows(cursor, stop, batch);
+        cursor = stop;
+        return cursor < end;
+    }
+};
+
+} // namespace
+
+// -----------------------------------------------
+// AsyncStudentWriter
+// -----------------------------------------------
+AsyncStudentWriter::AsyncStudentWriter(const std::string& filename,
+                                       const std::string& stageName,
+                                       std::size_t queueCapacity)
+    : queue(queueCapacity), filename(filename)
+{
+    writeStats.name = stageName;
+    writeStats.students = 0;
+    writeStats.busySeconds = 0.0;
+    worker = std::thread(&AsyncStudentWriter::run, this);
+}
+
+AsyncStudentWriter::~AsyncStudentWriter()
+{
+    if (worker.joinable()) {
+        queue.close();
+        worker.join();
+    }
+}
+
+void AsyncStudentWriter::push(std::vector<Person> batch)
+{
+    // After a write error the queue is closed and batches are dropped
+    queue.push(std::move(batch));
+}
+
+void AsyncStudentWriter::finish()
+{
+    if (worker.joinable()) {
+        queue.close();
+        worker.join();
+    }
+    if (error) std::rethrow_exception(error);
+}
+
+void AsyncStudentWriter::run()
+{
+    try {
+        PipelineClock::time_point start = PipelineClock::now();
+        StudentWriter writer(filename);
+        writer.writeHeader();
+        writeStats.busySeconds += secondsSince(start);
+
+        Batch batch;
+        while (queue.pop(batch)) {
+            start = PipelineClock::now();
+            for (std::size_t i = 0; i < batch.size(); ++i) writer.writeRow(batch[i]);
+            writeStats.students += batch.size();
+            writeStats.busySeconds += secondsSince(start);
+        }
+
+        start = PipelineClock::now();
+        writer.flush();
+        writeStats.busySeconds += secondsSince(start);
+    } catch (...) {
+        error = std::current_exception();
+        queue.close();
+    }
+}
+
+PipelineResult runGeneratePipeline(std::size_t count,
+                                   const StudentGenerator& generator,
+                                   const std::string& passedFile,
+                                   const std::string& failedFile,
+                                   const PipelineOptions& options)
+{
+    std::size_t batchSize = options.batchSize < 1 ? 1 : options.batchSize;
+    return runPipeline(GenerateSource(count, batchSize, generator), "Generate",
+                       passedFile, failedFile, options);
+}
+
+PipelineResult runFilePipeline(const std::string& inputFile,
+                               const std::string& passedFile,
+                               const std::string& failedFile,
+                               const PipelineOptions& options)
+{
+    MappedFile file(inputFile);
+    std::size_t batchSize = options.batchSize < 1 ? 1 : options.batchSize;
+    return runPipeline(FileSource(file, batchSize), "Parse",
+                       passedFile, failedFile, options);
+}
@@ -0,0 +1,100 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <cstddef>
+#include <exception>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BoundedQueue.h"
+#include "Person.h"
+#include "StudentGenerator.h"
+
+// -----------------------------------------------
+// Streaming pipeline: source -> grade -> split -> write
+//
+// Students flow through the stages in fixed-size batches.
+// Every stage runs on its own thread and the stages are
+// connected by BoundedQueues, so at most
+//     (queues x queueCapacity + stages) x batchSize
+// students are in memory at once, whatever the total N.
+//
+//   source  thread: generates (or parses) a batch
+//   grade   thread: calculateFinalGrades, routes each student
+//                   to a passed or a failed batch
+//   writer  threads: one AsyncStudentWriter per output file
+//
+// Output keeps source order; there is no sort stage.
+// -----------------------------------------------
+struct PipelineOptions {
+    std::size_t batchSize;       // students per batch
+    std::size_t queueCapacity;   // batches waiting between two stages
+
+    PipelineOptions() : batchSize(4096), queueCapacity(4) {}
+};
+
+struct StageStats {
+    std::string name;
+    std::size_t students;        // students handled by the stage
+    double busySeconds;          // time spent working, not waiting
+};
+
+// -----------------------------------------------
+// AsyncStudentWriter – one output file on its own thread
+//
+// The caller pushes batches of students and carries on; the
+// writer thread formats them with StudentWriter meanwhile, so
+// writing passed and failed overlaps each other and the work
+// that produces the batches. finish() waits for the last row
+// and rethrows any error the writer thread hit.
+// -----------------------------------------------
+class AsyncStudentWriter {
+private:
+    BoundedQueue<std::vector<Person> > queue;
+    StageStats writeStats;
+    std::exception_ptr error;
+    std::string filename;
+    std::thread worker;
+
+public:
+    AsyncStudentWriter(const std::string& filename, const std::string& stageName,
+                       std::size_t queueCapacity = 4);
+    ~AsyncStudentWriter();       // waits for the writer thread
+
+    // Blocks only while queueCapacity batches are already waiting
+    void push(std::vector<Person> batch);
+
+    void finish();
+
+    // Valid after finish()
+    const StageStats& stats() const { return writeStats; }
+
+private:
+    void run();
+
+    AsyncStudentWriter(const AsyncStudentWriter&);
+    AsyncStudentWriter& operator=(const AsyncStudentWriter&);
+};
+
+struct PipelineResult {
+    std::size_t passed;
+    std::size_t failed;
+    double wallSeconds;
+    std::vector<StageStats> stages;
+};
+
+// Source: N generated students
+PipelineResult runGeneratePipeline(std::size_t count,
+                                   const StudentGenerator& generator,
+                                   const std::string& passedFile,
+                                   const std::string& failedFile,
+                                   const PipelineOptions& options = PipelineOptions());
+
+// Source: a students*.txt file (memory-mapped, parsed batch by batch)
+PipelineResult runFilePipeline(const std::string& inputFile,
+                               const std::string& passedFile,
+                               const std::string& failedFile,
+                               const PipelineOptions& options = PipelineOptions());
+
+#endif // PIPELINE_H
@@ -0,0 +1,129 @@
+#ifndef SPLIT_STRATEGIES_H
+#define SPLIT_STRATEGIES_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+#include "Person.h"
+#include "GradeKernels.h"
+#include "StudentTable.h"
+#include "StudentPartition.h"
+
+// -----------------------------------------------
+// Passed / failed split strategies, shared by the program
+// and the benchmark executable
+// -----------------------------------------------
+
+// -----------------------------------------------
+// Predicates for passed / failed
+// -----------------------------------------------
+inline bool isPassed(const Person& p)
+{
+    // The grade itself, not the stored pass flag: students read from a
+    // file or snapshot are never graded, and a later median or score
+    // change would leave the flag stale
+    return p.getFinalGrade() >= kPassThreshold;
+}
+
+inline bool isFailed(const Person& p)
+{
+    return !isPassed(p);
+}
+
+// -----------------------------------------------
+// Strategy 1: copy students to TWO new containers
+//   - original students container is NOT changed
+//   - passed + failed are created using std::copy_if
+// -----------------------------------------------
+template <typename Container>
+void strategy1_splitCopy(const Container& students,
+                         Container& passed,
+                         Container& failed)
+{
+    passed.clear();
+    failed.clear();
+
+    std::copy_if(students.begin(), students.end(),
+                 std::back_inserter(passed), isPassed);
+
+    std::copy_if(students.begin(), students.end(),
+                 std::back_inserter(failed), isFailed);
+}
+
+// -----------------------------------------------
+// Strategy 2: move failed students OUT of base
+//   - after this, "students" contains only PASSED
+//   - "failed" contains FAILED students
+//   - uses the partition engine (StudentPartition.h): pass mask,
+//     then one stable pass (moves for vector/deque, splices for list)
+// -----------------------------------------------
+template <typename Container>
+void strategy2_moveFailed(Container& students,
+                          Container& failed)
+{
+    failed.clear();
+    moveFailedOut(students, failed, isPassed);
+}
+
+// -----------------------------------------------
+// Strategy 3: ONE pass copies students to passed + failed
+//   - original students container is NOT changed
+//   - pass mask + exact reserve, then one scatter pass
+//     (splitCopyOnePass in StudentPartition.h)
+// -----------------------------------------------
+template <typename Container>
+void strategy3_splitOnePass(const Container& students,
+                            Container& passed,
+                            Container& failed)
+{
+    passed.clear();
+    failed.clear();
+    splitCopyOnePass(students, passed, failed, isPassed);
+}
+
+// -----------------------------------------------
+// Strategies 1 / 2 / 3 for StudentTable (columnar rows)
+// -----------------------------------------------
+inline void strategy1_splitCopy(const StudentTable& students,
+                                StudentTable& passed,
+                                StudentTable& failed)
+{
+    passed.clear();
+    failed.clear();
+
+    for (std::size_t row = 0; row < students.size(); ++row)
+        if (students.finalGrade(row) >= kPassThreshold) passed.appendRow(students, row);
+
+    for (std::size_t row = 0; row < students.size(); ++row)
+        if (students.finalGrade(row) < kPassThreshold) failed.appendRow(students, row);
+}
+
+inline void strategy2_moveFailed(StudentTable& students,
+                                 StudentTable& failed)
+{
+    failed.clear();
+    students.moveFailedTo(failed, kPassThreshold);
+}
+
+inline void strategy3_splitOnePass(const StudentTable& students,
+                                   StudentTable& passed,
+                                   StudentTable& failed)
+{
+    passed.clear();
+    failed.clear();
+
+    std::size_t passedCount = 0;
+    for (std::size_t row = 0; row < students.size(); ++row)
+        passedCount += students.finalGrade(row) >= kPassThreshold ? 1 : 0;
+    passed.reserve(passedCount);
+    failed.reserve(students.size() - passedCount);
+
+    for (std::size_t row = 0; row < students.size(); ++row)
+    {
+        if (students.finalGrade(row) >= kPassThreshold) passed.appendRow(students, row);
+        else                                           failed.appendRow(students, row);
+    }
+}
+
+#endif // SPLIT_STRATEGIES_H
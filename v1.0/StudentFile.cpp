@@ -0,0 +1,520 @@
+#include "StudentFile.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// -----------------------------------------------
+// MappedFile
+// -----------------------------------------------
+#ifndef _WIN32
+MappedFile::MappedFile(const std::string& filename)
+    : bytes(""), length(0)
+{
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Could not open file: " + filename);
+    }
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw std::runtime_error("Could not read file size: " + filename);
+    }
+
+    if (info.st_size > 0) {
+        void* mapped = ::mmap(NULL, static_cast<std::size_t>(info.st_size),
+                              PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED) {
+            ::close(fd);
+            throw std::runtime_error("Could not map file: " + filename);
+        }
+        // We read the file front to back
+        ::madvise(mapped, static_cast<std::size_t>(info.st_size), MADV_SEQUENTIAL);
+
+        bytes  = static_cast<const char*>(mapped);
+        length = static_cast<std::size_t>(info.st_size);
+    }
+
+    // The mapping stays valid after the descriptor is closed
+    ::close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (length > 0) {
+        ::munmap(const_cast<char*>(bytes), length);
+    }
+}
+#else
+MappedFile::MappedFile(const std::string& filename)
+    : bytes(""), length(0)
+{
+    std::ifstream in(filename.c_str(), std::ios::binary | std::ios::ate);
+    if (!in.is_open()) {
+        throw std::runtime_error("Could not open file: " + filename);
+    }
+
+    std::streamsize fileSize = in.tellg();
+    in.seekg(0, std::ios::beg);
+    if (fileSize > 0) {
+        buffer.resize(static_cast<std::size_t>(fileSize));
+        in.read(&buffer[0], fileSize);
+        bytes  = &buffer[0];
+        length = buffer.size();
+    }
+}
+
+MappedFile::~MappedFile() {}
+#endif
+
+// -----------------------------------------------
+// Classic reader (getline + istringstream)
+// -----------------------------------------------
+std::vector<Person> readFromFile(const std::string& filename)
+{
+    std::vector<Person> students;
+    std::ifstream file(filename.c_str());
+
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not open file: " + filename);
+    }
+
+    std::string line;
+    // Skip header
+    if (!std::getline(file, line)) {
+        return students;
+    }
+
+    while (std::getline(file, line)) {
+        if (line.empty()) continue;
+
+        std::istringstream iss(line);
+        std::string firstName, surname;
+        int score;
+        std::vector<int> scores;
+
+        iss >> firstName >> surname;
+        if (firstName.empty() || surname.empty()) {
+            continue; // skip invalid lines
+        }
+
+        while (iss >> score) {
+            scores.push_back(score);
+        }
+
+        if (scores.empty()) {
+            continue;
+        }
+
+        Person p(std::move(firstName), std::move(surname));
+
+        int examScore = scores.back();
+        scores.pop_back();
+
+        p.setHomeworkScores(std::move(scores));
+        p.setExamScore(examScore);
+
+        students.push_back(std::move(p));
+    }
+
+    return students;
+}
+
+// -----------------------------------------------
+// Hand-written tokenizer for the mapped bytes
+// -----------------------------------------------
+namespace {
+
+inline bool isBlank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline const char* skipBlanks(const char* p, const char* end)
+{
+    while (p < end && isBlank(*p)) ++p;
+    return p;
+}
+
+inline const char* skipToken(const char* p, const char* end)
+{
+    while (p < end && !isBlank(*p)) ++p;
+    return p;
+}
+
+// Reads one integer starting at p. Returns false if there is none.
+// Like "iss >> score", a token such as "7x" yields 7 and ends the row,
+// and a value outside the int range is rejected (which ends the row).
+inline bool parseInt(const char*& p, const char* end, int& value, bool& stop)
+{
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        ++p;
+    }
+    if (p == end || *p < '0' || *p > '9') {
+        return false;
+    }
+
+    // Accumulate wider and stop growing once past the int range,
+    // so a long digit run cannot overflow
+    const long long limit = static_cast<long long>(std::numeric_limits<int>::max()) + 1;
+    long long result = 0;
+    while (p < end && *p >= '0' && *p <= '9') {
+        if (result <= limit) result = result * 10 + (*p - '0');
+        ++p;
+    }
+    if (result > (negative ? limit : limit - 1)) {
+        return false;
+    }
+    value = static_cast<int>(negative ? -result : result);
+    stop  = (p < end && !isBlank(*p));
+    return true;
+}
+
+// Parses one row [p, lineEnd). Appends a Person if the row is valid.
+// "scoreHint" carries the column count of the previous row so the
+// homework vector is allocated once at the right size.
+void parseRow(const char* p, const char* lineEnd,
+              std::vector<Person>& students, std::size_t& scoreHint)
+{
+    p = skipBlanks(p, lineEnd);
+    const char* first = p;
+    p = skipToken(p, lineEnd);
+    const char* firstEnd = p;
+
+    p = skipBlanks(p, lineEnd);
+    const char* last = p;
+    p = skipToken(p, lineEnd);
+    const char* lastEnd = p;
+
+    if (first == firstEnd || last == lastEnd) {
+        return; // skip invalid lines
+    }
+
+    students.emplace_back();
+    Person& person = students.back();
+    person.setFirstName(first, static_cast<std::size_t>(firstEnd - first));
+    person.setSurname(last, static_cast<std::size_t>(lastEnd - last));
+    person.reserveHomeworkScores(scoreHint);
+
+    // The last integer on the row is the exam score, so every value
+    // is held back by one step before it becomes a homework score
+    int pending = 0;
+    bool hasPending = false;
+    std::size_t count = 0;
+
+    for (;;) {
+        p = skipBlanks(p, lineEnd);
+        int value;
+        bool stop = false;
+        if (!parseInt(p, lineEnd, value, stop)) break;
+
+        if (hasPending) {
+            person.addHomeworkScore(pending);
+        }
+        pending = value;
+        hasPending = true;
+        ++count;
+
+        if (stop) break;
+    }
+
+    if (!hasPending) {
+        students.pop_back(); // row without scores
+        return;
+    }
+
+    person.setExamScore(pending);
+    scoreHint = count - 1;
+}
+
+} // namespace
+
+void parseStudentRows(const char* begin, const char* end,
+                      std::vector<Person>& students)
+{
+    std::size_t scoreHint = 0;
+    const char* p = begin;
+
+    while (p < end) {
+        const char* lineEnd = static_cast<const char*>(
+            std::memchr(p, '\n', static_cast<std::size_t>(end - p)));
+        if (lineEnd == NULL) lineEnd = end;
+
+        parseRow(p, lineEnd, students, scoreHint);
+        p = lineEnd + 1;
+    }
+}
+
+// -----------------------------------------------
+// Fast reader (memory-mapped)
+// -----------------------------------------------
+namespace {
+
+// Number of rows (newline-terminated or trailing) in [begin, end)
+std::size_t countRows(const char* begin, const char* end)
+{
+    std::size_t rows = 0;
+    for (const char* p = begin; p < end; ++rows) {
+        const char* nl = static_cast<const char*>(
+            std::memchr(p, '\n', static_cast<std::size_t>(end - p)));
+        p = (nl == NULL) ? end : nl + 1;
+    }
+    return rows;
+}
+
+// First row start at or after "p" (p itself if it already starts a row)
+const char* alignToRow(const char* body, const char* p, const char* end)
+{
+    if (p <= body) return body;
+    if (p[-1] == '\n') return p;
+
+    const char* nl = static_cast<const char*>(
+        std::memchr(p, '\n', static_cast<std::size_t>(end - p)));
+    return (nl == NULL) ? end : nl + 1;
+}
+
+void parseChunk(const char* begin, const char* end,
+                std::vector<Person>& students, std::exception_ptr& error)
+{
+    try {
+        students.reserve(countRows(begin, end));
+        parseStudentRows(begin, end, students);
+    } catch (...) {
+        error = std::current_exception();
+    }
+}
+
+} // namespace
+
+std::vector<Person> readFromFileMapped(const std::string& filename,
+                                       unsigned threads)
+{
+    MappedFile file(filename);
+    std::vector<Person> students;
+
+    const char* begin = file.data();
+    const char* end   = begin + file.size();
+
+    // Skip header
+    const char* body = static_cast<const char*>(
+        std::memchr(begin, '\n', file.size()));
+    if (body == NULL) {
+        return students;
+    }
+    ++body;
+
+    if (threads <= 1) {
+        // One memchr pass to size the vector exactly
+        students.reserve(countRows(body, end));
+        parseStudentRows(body, end, students);
+        return students;
+    }
+
+    // Split the body into newline-aligned byte ranges
+    std::size_t bodySize = static_cast<std::size_t>(end - body);
+    std::vector<const char*> bounds(threads + 1);
+    for (unsigned i = 0; i <= threads; ++i) {
+        bounds[i] = alignToRow(body, body + bodySize / threads * i, end);
+    }
+    bounds[threads] = end;
+
+    std::vector<std::vector<Person> > parts(threads);
+    std::vector<std::exception_ptr> errors(threads);
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+
+    for (unsigned i = 1; i < threads; ++i) {
+        workers.push_back(std::thread(parseChunk, bounds[i], bounds[i + 1],
+                                      std::ref(parts[i]), std::ref(errors[i])));
+    }
+    parseChunk(bounds[0], bounds[1], parts[0], errors[0]);
+
+    for (std::size_t i = 0; i < workers.size(); ++i) {
+        workers[i].join();
+    }
+    for (unsigned i = 0; i < threads; ++i) {
+        if (errors[i]) std::rethrow_exception(errors[i]);
+    }
+
+    // Ordered merge: chunk 0 rows first, then chunk 1, ...
+    std::size_t total = 0;
+    for (unsigned i = 0; i < threads; ++i) total += parts[i].size();
+    students.reserve(total);
+
+    for (unsigned i = 0; i < threads; ++i) {
+        students.insert(students.end(),
+                        std::make_move_iterator(parts[i].begin()),
+                        std::make_move_iterator(parts[i].end()));
+        std::vector<Person>().swap(parts[i]);
+    }
+
+    return students;
+}
+
+// -----------------------------------------------
+// Output files
+// -----------------------------------------------
+void writeStudentHeader(std::ostream& out)
+{
+    out << std::left << std::setw(20) << "FirstName"
+        << std::setw(20) << "Surname"
+        << std::right << std::setw(10) << "Final\n";
+    out << std::string(50, '-') << "\n";
+}
+
+// -----------------------------------------------
+// StudentWriter
+// -----------------------------------------------
+namespace {
+
+const std::size_t kNameWidth  = 20;
+const std::size_t kGradeWidth = 10;
+const std::size_t kMaxGradeChars = 350;   // "%.2f" of the largest double
+
+// "%.2f" of value into out, returns the length.
+// Values below 10^6 are formatted from the rounded cents; when the
+// product value * 100 is too close to a rounding tie to decide
+// (and for negatives, NaN, huge values) printf does it instead.
+std::size_t formatGrade(double value, char* out)
+{
+    if (!std::signbit(value) && value < 1e6) {
+        double scaled = value * 100.0;
+        double whole  = std::floor(scaled);
+        double frac   = scaled - whole;
+        if (std::fabs(frac - 0.5) > 1e-6) {
+            unsigned long cents = static_cast<unsigned long>(whole) + (frac > 0.5 ? 1 : 0);
+            unsigned long units = cents / 100;
+
+            char digits[16];
+            std::size_t count = 0;
+            do {
+                digits[count++] = static_cast<char>('0' + units % 10);
+                units /= 10;
+            } while (units != 0);
+
+            std::size_t length = 0;
+            while (count > 0) out[length++] = digits[--count];
+            out[length++] = '.';
+            out[length++] = static_cast<char>('0' + cents % 100 / 10);
+            out[length++] = static_cast<char>('0' + cents % 10);
+            return length;
+        }
+    }
+    return static_cast<std::size_t>(std::snprintf(out, kMaxGradeChars, "%.2f", value));
+}
+
+inline char* putPadded(char* p, const char* text, std::size_t length, std::size_t width)
+{
+    std::memcpy(p, text, length);
+    p += length;
+    if (length < width) {
+        std::memset(p, ' ', width - length);
+        p += width - length;
+    }
+    return p;
+}
+
+} // namespace
+
+StudentWriter::StudentWriter(const std::string& filename, std::size_t bufferSize)
+    : out(filename.c_str()), filename(filename),
+      buffer(bufferSize < 4096 ? 4096 : bufferSize), used(0), written(0)
+{
+    if (!out.is_open()) {
+        throw std::runtime_error("Could not open file for writing: " + filename);
+    }
+}
+
+StudentWriter::~StudentWriter()
+{
+    try {
+        flush();
+    } catch (...) {
+        // Destructors must not throw; call flush() to see errors
+    }
+}
+
+char* StudentWriter::space(std::size_t bytes)
+{
+    if (used + bytes > buffer.size()) {
+        flush();
+        if (bytes > buffer.size()) buffer.resize(bytes);
+    }
+    char* p = &buffer[used];
+    used += bytes;
+    return p;
+}
+
+void StudentWriter::writeHeader()
+{
+    static const char header[] =
+        "FirstName           Surname                 Final\n"
+        "--------------------------------------------------\n";
+    std::memcpy(space(sizeof(header) - 1), header, sizeof(header) - 1);
+}
+
+void StudentWriter::writeRow(const Person& person)
+{
+    writeRow(person.getFirstName().data(), person.getFirstName().size(),
+             person.getSurname().data(), person.getSurname().size(),
+             person.getFinalGrade());
+}
+
+void StudentWriter::writeRow(const StudentTableRow& row)
+{
+    writeRow(row.firstNameData(), row.firstNameLength(),
+             row.surnameData(), row.surnameLength(),
+             row.getFinalGrade());
+}
+
+void StudentWriter::writeRow(const char* firstName, std::size_t firstLength,
+                             const char* surname, std::size_t surnameLength,
+                             double finalGrade)
+{
+    char grade[kMaxGradeChars];
+    std::size_t gradeLength = formatGrade(finalGrade, grade);
+
+    std::size_t worst = (firstLength > kNameWidth ? firstLength : kNameWidth)
+                      + (surnameLength > kNameWidth ? surnameLength : kNameWidth)
+                      + (gradeLength > kGradeWidth ? gradeLength : kGradeWidth) + 1;
+    // Every field is at least as wide as its padding, so "worst" is exact
+    char* p = putPadded(space(worst), firstName, firstLength, kNameWidth);
+    p = putPadded(p, surname, surnameLength, kNameWidth);
+    if (gradeLength < kGradeWidth) {
+        std::memset(p, ' ', kGradeWidth - gradeLength);
+        p += kGradeWidth - gradeLength;
+    }
+    std::memcpy(p, grade, gradeLength);
+    p += gradeLength;
+    *p = '\n';
+}
+
+void StudentWriter::flush()
+{
+    if (used == 0) return;
+    out.write(&buffer[0], static_cast<std::streamsize>(used));
+    out.flush();
+    written += used;
+    used = 0;
+    if (!out) {
+        throw std::runtime_error("Could not write file: " + filename);
+    }
+}
@@ -0,0 +1,127 @@
+#ifndef STUDENT_FILE_H
+#define STUDENT_FILE_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <fstream>
+#include <ostream>
+#include <stdexcept>
+
+#include "Person.h"
+#include "StudentTable.h"
+
+// -----------------------------------------------
+// Read-only view of a whole file in memory.
+// Uses mmap on POSIX systems; on Windows the file
+// is read into one buffer instead.
+// -----------------------------------------------
+class MappedFile {
+private:
+    const char* bytes;
+    std::size_t length;
+#ifdef _WIN32
+    std::vector<char> buffer;
+#endif
+
+public:
+    explicit MappedFile(const std::string& filename);
+    ~MappedFile();
+
+    const char* data() const { return bytes; }
+    std::size_t size() const { return length; }
+
+private:
+    MappedFile(const MappedFile&);               // not copyable
+    MappedFile& operator=(const MappedFile&);
+};
+
+// -----------------------------------------------
+// students*.txt readers
+//   Format: header line, then per row
+//   FirstName Surname ND1 ... NDk Egz.
+// -----------------------------------------------
+
+// Classic reader: getline + istringstream per row (v0.2 behaviour)
+std::vector<Person> readFromFile(const std::string& filename);
+
+// Fast reader: parses the memory-mapped bytes directly,
+// no per-line string or stringstream is ever created.
+// With threads > 1 the rows are split into newline-aligned byte
+// ranges, parsed in parallel and merged back in file order.
+std::vector<Person> readFromFileMapped(const std::string& filename,
+                                       unsigned threads = 1);
+
+// Parse rows in [begin, end) and append them to "students".
+// "begin" must point at the start of a row.
+void parseStudentRows(const char* begin, const char* end,
+                      std::vector<Person>& students);
+
+// -----------------------------------------------
+// students_N_passed / failed output files (v0.2 layout)
+//   FirstName(20) Surname(20) Final(10, 2 decimals)
+//
+// writeStudentHeader / writeStudentRow format through the stream
+// (setw / fixed / setprecision); they are the reference that
+// StudentWriter below is checked against.
+// -----------------------------------------------
+void writeStudentHeader(std::ostream& out);
+
+inline void writeStudentRow(std::ostream& out, const Person& person)
+{
+    out << person << '\n';
+}
+
+// -----------------------------------------------
+// StudentWriter – buffered writer for the output files
+//
+// Rows are formatted by hand (names padded to 20, grade right-
+// aligned in 10 with two decimals) into one large reusable buffer
+// that goes to the file in big write() calls. The bytes are
+// identical to writeStudentHeader + writeStudentRow.
+// -----------------------------------------------
+class StudentWriter {
+private:
+    std::ofstream out;
+    std::string filename;
+    std::vector<char> buffer;
+    std::size_t used;
+    unsigned long long written;
+
+public:
+    explicit StudentWriter(const std::string& filename,
+                           std::size_t bufferSize = 1 << 20);
+    ~StudentWriter();            // flushes what is left
+
+    void writeHeader();
+    void writeRow(const Person& person);
+    void writeRow(const StudentTableRow& row);
+    void writeRow(const char* firstName, std::size_t firstLength,
+                  const char* surname, std::size_t surnameLength,
+                  double finalGrade);
+
+    void flush();
+
+    // Bytes handed to the file so far (including the buffer)
+    unsigned long long bytesWritten() const { return written + used; }
+
+private:
+    char* space(std::size_t bytes);
+
+    StudentWriter(const StudentWriter&);         // not copyable
+    StudentWriter& operator=(const StudentWriter&);
+};
+
+template <typename Container>
+void writeStudentsToFile(const Container& students, const std::string& filename)
+{
+    StudentWriter writer(filename);
+    writer.writeHeader();
+    for (typename Container::const_iterator it = students.begin();
+         it != students.end(); ++it) {
+        writer.writeRow(*it);
+    }
+    writer.flush();
+}
+
+#endif // STUDENT_FILE_H
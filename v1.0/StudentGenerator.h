@@ -0,0 +1,55 @@
+#ifndef STUDENT_GENERATOR_H
+#define STUDENT_GENERATOR_H
+
+#include <cstddef>
+#include <stdint.h>
+
+#include "Person.h"
+
+// -----------------------------------------------
+// StudentGenerator – reproducible random students
+//
+// Every student index has its own counter-based random stream
+// (SplitMix64 started from a hash of seed and index), so a
+// student's data depends only on (seed, index). Generating
+// with 1 or N threads, in any order, gives the same dataset.
+// -----------------------------------------------
+class StudentGenerator {
+public:
+    static const std::size_t kHomeworkCount = 15;
+
+    // Random stream of one student
+    class Stream {
+    private:
+        uint64_t state;
+
+    public:
+        explicit Stream(uint64_t state) : state(state) {}
+
+        uint64_t next();
+        int nextScore();             // uniform 1..10
+    };
+
+    explicit StudentGenerator(uint64_t seed);
+
+    uint64_t getSeed() const { return seed; }
+
+    Stream stream(std::size_t index) const;
+
+private:
+    uint64_t seed;
+};
+
+// Student "index": Name<i+1> Surname<i+1>, 15 homework scores
+// and an exam score from the generator's stream (not graded)
+void fillRandomStudent(Person& p, std::size_t index,
+                       const StudentGenerator& generator);
+
+// fillRandomStudent + Person::calculateFinalGrades
+void fillRandomScores(Person& p, std::size_t index,
+                      const StudentGenerator& generator);
+
+// Fresh seed from std::random_device (for runs without an explicit seed)
+uint64_t randomSeed();
+
+#endif // STUDENT_GENERATOR_H
@@ -0,0 +1,273 @@
+#ifndef STUDENT_PARTITION_H
+#define STUDENT_PARTITION_H
+
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <stdint.h>
+
+#include "Parallel.h"
+
+// -----------------------------------------------
+// Partition engine for Strategy 2 (move failed out of the base)
+//
+// The predicate is evaluated once per student into a pass mask.
+// From the mask the final position of every student is known –
+// passed students keep their order at the front, failed ones go
+// to "failed" in order – so that permutation is applied in one
+// forward pass:
+//   vector / deque – each student is moved at most once (passed
+//                    slide down, failed move out); "failed" is
+//                    reserved from the mask count; no temporary
+//                    buffer as in std::stable_partition
+//   list           – failed nodes are spliced into "failed";
+//                    no student is moved or allocated
+// Result and order are the same as stable_partition + move + erase.
+// -----------------------------------------------
+template <typename Container, typename Predicate>
+std::size_t buildPassMask(const Container& students, Predicate passed,
+                          std::vector<uint8_t>& mask)
+{
+    mask.resize(students.size());
+    std::size_t count = 0;
+    std::size_t i = 0;
+    for (typename Container::const_iterator it = students.begin();
+         it != students.end(); ++it, ++i) {
+        mask[i] = passed(*it) ? 1 : 0;
+        count += mask[i];
+    }
+    return count;
+}
+
+namespace partitionDetail {
+
+template <typename T, typename A>
+void reserveFor(std::vector<T, A>& students, std::size_t count)
+{
+    students.reserve(students.size() + count);
+}
+
+template <typename Sequence>
+void reserveFor(Sequence&, std::size_t) {}
+
+template <typename Sequence, typename Predicate>
+void moveFailedSequence(Sequence& students, Sequence& failed, Predicate passed)
+{
+    std::vector<uint8_t> mask;
+    std::size_t passedCount = buildPassMask(students, passed, mask);
+    reserveFor(failed, students.size() - passedCount);
+
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < mask.size(); ++i) {
+        if (mask[i]) {
+            if (kept != i) students[kept] = std::move(students[i]);
+            ++kept;
+        } else {
+            failed.push_back(std::move(students[i]));
+        }
+    }
+    students.erase(students.begin() + kept, students.end());
+}
+
+} // namespace partitionDetail
+
+template <typename T, typename A, typename Predicate>
+void moveFailedOut(std::vector<T, A>& students, std::vector<T, A>& failed, Predicate passed)
+{
+    partitionDetail::moveFailedSequence(students, failed, passed);
+}
+
+template <typename T, typename A, typename Predicate>
+void moveFailedOut(std::deque<T, A>& students, std::deque<T, A>& failed, Predicate passed)
+{
+    partitionDetail::moveFailedSequence(students, failed, passed);
+}
+
+template <typename T, typename A, typename Predicate>
+void moveFailedOut(std::list<T, A>& students, std::list<T, A>& failed, Predicate passed)
+{
+    typedef typename std::list<T, A>::iterator Iterator;
+
+    std::vector<uint8_t> mask;
+    buildPassMask(students, passed, mask);
+
+    // Nodes can only change lists that share an allocator
+    // (e.g. the same arena); otherwise the students are moved
+    bool splice = students.get_allocator() == failed.get_allocator();
+
+    std::size_t i = 0;
+    for (Iterator it = students.begin(); it != students.end(); ++i) {
+        if (mask[i]) {
+            ++it;
+        } else if (splice) {
+            failed.splice(failed.end(), students, it++);
+        } else {
+            failed.push_back(std::move(*it));
+            it = students.erase(it);
+        }
+    }
+}
+
+// -----------------------------------------------
+// Single-pass split for Strategy 3 (copy to passed + failed)
+//
+// The mask pass counts the passed students, both outputs are
+// reserved to their exact sizes (vector), and one scatter pass
+// copies every student to the right output. The predicate runs
+// once per student instead of twice (copy_if(isPassed) +
+// copy_if(isFailed)), and the outputs never reallocate.
+// -----------------------------------------------
+template <typename Container, typename Predicate>
+void splitCopyOnePass(const Container& students, Container& passed,
+                      Container& failed, Predicate isPassed)
+{
+    std::vector<uint8_t> mask;
+    std::size_t passedCount = buildPassMask(students, isPassed, mask);
+    partitionDetail::reserveFor(passed, passedCount);
+    partitionDetail::reserveFor(failed, students.size() - passedCount);
+
+    std::size_t i = 0;
+    for (typename Container::const_iterator it = students.begin();
+         it != students.end(); ++it, ++i) {
+        if (mask[i]) passed.push_back(*it);
+        else         failed.push_back(*it);
+    }
+}
+
+// -----------------------------------------------
+// Parallel split (copy to passed + failed on N threads)
+//
+// The input is cut into one contiguous slice per thread.
+//   vector / deque – every slice fills its part of the pass mask
+//                    and counts its passed students; a prefix sum
+//                    over the counts gives each slice its first
+//                    position in "passed" and "failed", and the
+//                    slices then copy their students straight into
+//                    place in parallel
+//   list           – every slice copies into its own passed/failed
+//                    lists, which are spliced on in slice order
+// Both outputs are appended to and keep the input order, so the
+// result is the same as splitCopyOnePass on one thread.
+// -----------------------------------------------
+namespace partitionDetail {
+
+const std::size_t kMinSlice = 4096;
+
+inline unsigned sliceCount(std::size_t count, unsigned threads)
+{
+    std::size_t most = count / kMinSlice;
+    if (most < 1) most = 1;
+    if (threads < 1) threads = 1;
+    return threads < most ? threads : static_cast<unsigned>(most);
+}
+
+template <typename Sequence, typename Predicate>
+void parallelSplitSequence(const Sequence& students, Sequence& passed,
+                           Sequence& failed, Predicate isPassed, unsigned threads)
+{
+    std::size_t count = students.size();
+    unsigned parts = sliceCount(count, threads);
+
+    // 1) Classify: mask + passed/failed count per slice
+    std::vector<uint8_t> mask(count);
+    std::vector<std::size_t> passedAt(parts + 1, 0);
+    std::vector<std::size_t> failedAt(parts + 1, 0);
+    parallelFor(count, parts, [&](std::size_t begin, std::size_t end, unsigned part) {
+        std::size_t n = 0;
+        for (std::size_t i = begin; i < end; ++i) {
+            mask[i] = isPassed(students[i]) ? 1 : 0;
+            n += mask[i];
+        }
+        passedAt[part + 1] = n;
+        failedAt[part + 1] = end - begin - n;
+    });
+
+    // 2) Prefix sum: first output position of every slice
+    std::size_t passedBase = passed.size();
+    std::size_t failedBase = failed.size();
+    passedAt[0] = passedBase;
+    failedAt[0] = failedBase;
+    for (unsigned part = 0; part < parts; ++part) {
+        passedAt[part + 1] += passedAt[part];
+        failedAt[part + 1] += failedAt[part];
+    }
+    passed.resize(passedAt[parts]);
+    failed.resize(failedAt[parts]);
+
+    // 3) Scatter: same slices as step 1, each into its own range
+    parallelFor(count, parts, [&](std::size_t begin, std::size_t end, unsigned part) {
+        std::size_t p = passedAt[part];
+        std::size_t f = failedAt[part];
+        for (std::size_t i = begin; i < end; ++i) {
+            if (mask[i]) passed[p++] = students[i];
+            else         failed[f++] = students[i];
+        }
+    });
+}
+
+} // namespace partitionDetail
+
+template <typename T, typename A, typename Predicate>
+void parallelSplitCopy(const std::vector<T, A>& students, std::vector<T, A>& passed,
+                       std::vector<T, A>& failed, Predicate isPassed, unsigned threads)
+{
+    partitionDetail::parallelSplitSequence(students, passed, failed, isPassed, threads);
+}
+
+template <typename T, typename A, typename Predicate>
+void parallelSplitCopy(const std::deque<T, A>& students, std::deque<T, A>& passed,
+                       std::deque<T, A>& failed, Predicate isPassed, unsigned threads)
+{
+    partitionDetail::parallelSplitSequence(students, passed, failed, isPassed, threads);
+}
+
+template <typename T, typename A, typename Predicate>
+void parallelSplitCopy(const std::list<T, A>& students, std::list<T, A>& passed,
+                       std::list<T, A>& failed, Predicate isPassed, unsigned threads)
+{
+    typedef typename std::list<T, A>::const_iterator Iterator;
+
+    // New nodes come from the outputs' allocator: only the plain heap
+    // may be used from several threads (an arena belongs to one thread)
+    std::size_t count = students.size();
+    unsigned parts = std::is_same<A, std::allocator<T> >::value
+                   ? partitionDetail::sliceCount(count, threads) : 1;
+    if (parts <= 1) {
+        splitCopyOnePass(students, passed, failed, isPassed);
+        return;
+    }
+
+    // One walk finds where every slice starts
+    std::vector<Iterator> starts(parts + 1, students.end());
+    Iterator it = students.begin();
+    std::size_t position = 0;
+    for (unsigned part = 0; part < parts; ++part) {
+        std::size_t target = count * part / parts;
+        std::advance(it, target - position);
+        position = target;
+        starts[part] = it;
+    }
+
+    std::vector<std::list<T, A> > slicePassed(parts, std::list<T, A>(passed.get_allocator()));
+    std::vector<std::list<T, A> > sliceFailed(parts, std::list<T, A>(failed.get_allocator()));
+    parallelFor(parts, parts, [&](std::size_t begin, std::size_t end, unsigned) {
+        for (std::size_t part = begin; part < end; ++part) {
+            for (Iterator s = starts[part]; s != starts[part + 1]; ++s) {
+                if (isPassed(*s)) slicePassed[part].push_back(*s);
+                else              sliceFailed[part].push_back(*s);
+            }
+        }
+    });
+
+    for (unsigned part = 0; part < parts; ++part) {
+        passed.splice(passed.end(), slicePassed[part]);
+        failed.splice(failed.end(), sliceFailed[part]);
+    }
+}
+
+#endif // STUDENT_PARTITION_H
@@ -0,0 +1,176 @@
+#include "StudentSnapshot.h"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+
+const char kSnapshotMagic[8] = {'S', 'T', 'U', 'S', 'N', 'A', 'P', '\0'};
+const uint32_t kByteOrderMark = 0x01020304;
+const uint64_t kHasFinalGrades = 1;
+
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint64_t rows;
+    uint64_t homeworkCount;
+    uint64_t nameBytes;
+    uint64_t flags;
+    uint64_t nameOffsetsAt;      // byte offsets of the sections
+    uint64_t namesAt;
+    uint64_t homeworkAt;
+    uint64_t examAt;
+    uint64_t gradesAt;           // 0 without grades
+};
+
+inline uint64_t align8(uint64_t position)
+{
+    return (position + 7) & ~static_cast<uint64_t>(7);
+}
+
+// Write "bytes" at "at", padding from the current position
+void writeSection(std::ofstream& out, uint64_t& position, uint64_t at,
+                  const void* data, std::size_t bytes)
+{
+    static const char zeros[8] = {0};
+    out.write(zeros, static_cast<std::streamsize>(at - position));
+    if (bytes > 0) out.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+    position = at + bytes;
+}
+
+} // namespace
+
+// -----------------------------------------------
+// Save
+// -----------------------------------------------
+void saveSnapshot(const StudentTable& students, const std::string& filename,
+                  bool withGrades)
+{
+    std::size_t rows = students.size();
+    std::size_t hwBytes = rows * students.homeworkCount();
+
+    SnapshotHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, kSnapshotMagic, sizeof(header.magic));
+    header.version = kSnapshotVersion;
+    header.byteOrder = kByteOrderMark;
+    header.rows = rows;
+    header.homeworkCount = students.homeworkCount();
+    header.nameBytes = students.namePoolSize();
+    header.flags = withGrades ? kHasFinalGrades : 0;
+
+    header.nameOffsetsAt = align8(sizeof(header));
+    header.namesAt    = align8(header.nameOffsetsAt + (2 * rows + 1) * sizeof(uint32_t));
+    header.homeworkAt = align8(header.namesAt + header.nameBytes);
+    header.examAt     = align8(header.homeworkAt + hwBytes);
+    header.gradesAt   = withGrades ? align8(header.examAt + rows) : 0;
+
+    std::ofstream out(filename.c_str(), std::ios::binary);
+    if (!out.is_open()) {
+        throw std::runtime_error("Could not open file for writing: " + filename);
+    }
+
+    uint64_t position = 0;
+    writeSection(out, position, 0, &header, sizeof(header));
+    writeSection(out, position, header.nameOffsetsAt, students.nameOffsetData(),
+                 (2 * rows + 1) * sizeof(uint32_t));
+    writeSection(out, position, header.namesAt, students.namePool(), header.nameBytes);
+    writeSection(out, position, header.homeworkAt, students.homeworkData(), hwBytes);
+    writeSection(out, position, header.examAt, students.examData(), rows);
+    if (withGrades) {
+        writeSection(out, position, header.gradesAt, students.finalGradeData(),
+                     rows * sizeof(double));
+    }
+
+    out.flush();
+    if (!out) {
+        throw std::runtime_error("Could not write file: " + filename);
+    }
+}
+
+// -----------------------------------------------
+// Load
+// -----------------------------------------------
+StudentSnapshot::StudentSnapshot(const std::string& filename)
+    : file(filename), rows(0), hwCount(0), nameOffsets(NULL), names(NULL),
+      homework(NULL), exam(NULL), finalGrades(NULL)
+{
+    const std::string bad = "Not a valid student snapshot: " + filename;
+
+    SnapshotHeader header;
+    if (file.size() < sizeof(header)) throw std::runtime_error(bad);
+    std::memcpy(&header, file.data(), sizeof(header));
+
+    if (std::memcmp(header.magic, kSnapshotMagic, sizeof(header.magic)) != 0) {
+        throw std::runtime_error(bad);
+    }
+    if (header.byteOrder != kByteOrderMark) {
+        throw std::runtime_error("Snapshot has a different byte order: " + filename);
+    }
+    if (header.version != kSnapshotVersion) {
+        throw std::runtime_error("Unsupported snapshot version: " + filename);
+    }
+
+    // Every section must lie inside the file (sizes are checked
+    // against the file length first so the products cannot overflow)
+    uint64_t size = file.size();
+    bool hasGrades = (header.flags & kHasFinalGrades) != 0;
+    if (header.rows > size || header.homeworkCount > size || header.nameBytes > size ||
+        (header.homeworkCount != 0 && header.rows > size / header.homeworkCount)) {
+        throw std::runtime_error(bad);
+    }
+    uint64_t offsetBytes = (2 * header.rows + 1) * sizeof(uint32_t);
+    if (header.nameOffsetsAt % 8 != 0 || header.gradesAt % 8 != 0 ||
+        header.nameOffsetsAt > size || offsetBytes > size - header.nameOffsetsAt ||
+        header.namesAt > size || header.nameBytes > size - header.namesAt ||
+        header.homeworkAt > size || header.rows * header.homeworkCount > size - header.homeworkAt ||
+        header.examAt > size || header.rows > size - header.examAt ||
+        (hasGrades && (header.gradesAt > size ||
+                       header.rows > (size - header.gradesAt) / sizeof(double)))) {
+        throw std::runtime_error(bad);
+    }
+
+    const char* base = file.data();
+    rows = static_cast<std::size_t>(header.rows);
+    hwCount = static_cast<std::size_t>(header.homeworkCount);
+    nameOffsets = reinterpret_cast<const uint32_t*>(base + header.nameOffsetsAt);
+    names       = base + header.namesAt;
+    homework    = reinterpret_cast<const uint8_t*>(base + header.homeworkAt);
+    exam        = reinterpret_cast<const uint8_t*>(base + header.examAt);
+    finalGrades = hasGrades ? reinterpret_cast<const double*>(base + header.gradesAt) : NULL;
+
+    // Name offsets index into the pool, so they must be ordered and
+    // end at its size
+    if (nameOffsets[0] != 0 || nameOffsets[2 * rows] != header.nameBytes) {
+        throw std::runtime_error(bad);
+    }
+    for (std::size_t i = 0; i < 2 * rows; ++i) {
+        if (nameOffsets[i] > nameOffsets[i + 1]) throw std::runtime_error(bad);
+    }
+}
+
+StudentTable StudentSnapshot::toTable() const
+{
+    StudentTable table(hwCount);
+    table.assign(hwCount, rows, homework, exam, finalGrades, names, nameOffsets);
+    return table;
+}
+
+std::vector<Person> StudentSnapshot::toPersons() const
+{
+    std::vector<Person> students;
+    students.reserve(rows);
+
+    for (std::size_t row = 0; row < rows; ++row) {
+        Person person(std::string(firstNameData(row), firstNameLength(row)),
+                      std::string(surnameData(row), surnameLength(row)));
+        const uint8_t* scores = homework + row * hwCount;
+        person.reserveHomeworkScores(hwCount);
+        for (std::size_t i = 0; i < hwCount; ++i) person.addHomeworkScore(scores[i]);
+        person.setExamScore(exam[row]);
+        students.push_back(std::move(person));
+    }
+    return students;
+}
@@ -0,0 +1,101 @@
+#ifndef STUDENT_SNAPSHOT_H
+#define STUDENT_SNAPSHOT_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <stdint.h>
+
+#include "Person.h"
+#include "StudentFile.h"
+#include "StudentTable.h"
+
+// -----------------------------------------------
+// Binary student snapshot (*.snap)
+//
+// The StudentTable columns written as they are in memory, so
+// loading is a mmap plus a bounds check, with no per-row parsing:
+//   header      – magic "STUSNAP\0", version, byte-order mark,
+//                 row / homework / name-pool sizes, section offsets
+//   nameOffsets – uint32 x (2 * rows + 1)   (StudentTable layout)
+//   names       – name pool, all names back to back
+//   homework    – uint8 matrix, rows x homeworkCount, row-major
+//   exam        – uint8 x rows
+//   finalGrades – double x rows (only if saved with grades)
+// Sections start on 8-byte boundaries. Integers are stored in
+// native byte order; a snapshot from a machine with the other
+// order is rejected.
+// -----------------------------------------------
+const uint32_t kSnapshotVersion = 1;
+
+// Save a table; withGrades also stores its finalGrade column
+void saveSnapshot(const StudentTable& students, const std::string& filename,
+                  bool withGrades = false);
+
+// Save any container of Person (same homework count for every
+// student, scores 0..255). Only such data round-trips exactly
+// with the text format; anything else throws
+// std::invalid_argument (from StudentTable::addStudent).
+template <typename Container>
+void saveSnapshot(const Container& students, const std::string& filename,
+                  bool withGrades = false)
+{
+    std::size_t homeworkCount = students.empty()
+        ? 0 : students.begin()->getHomeworkScores().size();
+
+    StudentTable table(homeworkCount);
+    for (typename Container::const_iterator it = students.begin();
+         it != students.end(); ++it) {
+        table.addStudent(*it);
+    }
+    saveSnapshot(table, filename, withGrades);
+}
+
+// -----------------------------------------------
+// StudentSnapshot – read-only view of a mapped snapshot
+// (the columns point straight into the file)
+// -----------------------------------------------
+class StudentSnapshot {
+private:
+    MappedFile file;
+    std::size_t rows;
+    std::size_t hwCount;
+    const uint32_t* nameOffsets;
+    const char* names;
+    const uint8_t* homework;
+    const uint8_t* exam;
+    const double* finalGrades;   // NULL if saved without grades
+
+public:
+    explicit StudentSnapshot(const std::string& filename);
+
+    std::size_t size() const { return rows; }
+    std::size_t homeworkCount() const { return hwCount; }
+    bool hasFinalGrades() const { return finalGrades != NULL; }
+
+    const uint8_t* homeworkData() const { return homework; }
+    const uint8_t* examData() const { return exam; }
+    const double* finalGradeData() const { return finalGrades; }
+
+    const char* firstNameData(std::size_t row) const { return names + nameOffsets[2 * row]; }
+    std::size_t firstNameLength(std::size_t row) const { return nameOffsets[2 * row + 1] - nameOffsets[2 * row]; }
+    const char* surnameData(std::size_t row) const { return names + nameOffsets[2 * row + 1]; }
+    std::size_t surnameLength(std::size_t row) const { return nameOffsets[2 * row + 2] - nameOffsets[2 * row + 1]; }
+
+    // Copy into owned storage: bulk column copies for the table;
+    // Persons get names and scores like readFromFile (not graded)
+    StudentTable toTable() const;
+    std::vector<Person> toPersons() const;
+};
+
+inline StudentTable loadSnapshotTable(const std::string& filename)
+{
+    return StudentSnapshot(filename).toTable();
+}
+
+inline std::vector<Person> loadSnapshot(const std::string& filename)
+{
+    return StudentSnapshot(filename).toPersons();
+}
+
+#endif // STUDENT_SNAPSHOT_H
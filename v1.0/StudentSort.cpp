@@ -0,0 +1,128 @@
+#include "StudentSort.h"
+
+#include <cstring>
+#include <string>
+
+#include "Collation.h"
+
+// -----------------------------------------------
+// LSD radix sort of the 16-byte keys
+// -----------------------------------------------
+namespace {
+
+inline unsigned keyByte(const SortKey& key, int position)
+{
+    // position 0 is the most significant byte of hi
+    return position < 8
+        ? static_cast<unsigned>(key.hi >> (8 * (7 - position))) & 0xFF
+        : static_cast<unsigned>(key.lo >> (8 * (15 - position))) & 0xFF;
+}
+
+// Same result as std::string::compare
+inline int compareBytes(const char* a, std::size_t aLength,
+                        const char* b, std::size_t bLength)
+{
+    int result = std::memcmp(a, b, aLength < bLength ? aLength : bLength);
+    if (result != 0) return result;
+    return aLength < bLength ? -1 : (aLength > bLength ? 1 : 0);
+}
+
+} // namespace
+
+void radixSortKeys(std::vector<SortKey>& keys)
+{
+    std::size_t count = keys.size();
+    if (count < 2) return;
+
+    // Histograms for all 16 byte positions in one pass
+    std::vector<std::size_t> counts(16 * 256, 0);
+    for (std::size_t i = 0; i < count; ++i) {
+        for (int position = 0; position < 16; ++position) {
+            ++counts[position * 256 + keyByte(keys[i], position)];
+        }
+    }
+
+    std::vector<SortKey> scratch(count);
+    for (int position = 15; position >= 0; --position) {
+        std::size_t* bucket = &counts[position * 256];
+
+        // Same byte in every key: this pass would change nothing
+        if (bucket[keyByte(keys[0], position)] == count) continue;
+
+        std::size_t offset = 0;
+        for (int digit = 0; digit < 256; ++digit) {
+            std::size_t size = bucket[digit];
+            bucket[digit] = offset;
+            offset += size;
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            scratch[bucket[keyByte(keys[i], position)]++] = keys[i];
+        }
+        keys.swap(scratch);
+    }
+}
+
+// -----------------------------------------------
+// StudentTable
+// -----------------------------------------------
+void sortStudents(StudentTable& students, SortEngine engine, unsigned threads)
+{
+    std::size_t count = students.size();
+    sortDetail::checkKeyCount(count);
+
+    // Full (surname, first name) order of two rows
+    StudentTable& table = students;
+    auto less = [&table](uint32_t a, uint32_t b) {
+        int bySurname = compareBytes(table.surnameData(a), table.surnameLength(a),
+                                     table.surnameData(b), table.surnameLength(b));
+        if (bySurname != 0) return bySurname < 0;
+        return compareBytes(table.firstNameData(a), table.firstNameLength(a),
+                            table.firstNameData(b), table.firstNameLength(b)) < 0;
+    };
+
+    std::vector<uint32_t> order(count);
+
+    if (engine == SortNatural) {
+        std::vector<std::string> natural(count);
+        std::vector<SortKey> keys(count);
+        for (std::size_t row = 0; row < count; ++row) {
+            std::string& key = natural[row];
+            appendNaturalKey(key, students.surnameData(row), students.surnameLength(row));
+            key += '\0';
+            appendNaturalKey(key, students.firstNameData(row), students.firstNameLength(row));
+            makePrefixKey(key.data(), key.size(), static_cast<uint32_t>(row), keys[row]);
+        }
+
+        sortDetail::finishKeySort(keys, [&natural, &less](uint32_t a, uint32_t b) {
+            int byKey = natural[a].compare(natural[b]);
+            if (byKey != 0) return byKey < 0;
+            return less(a, b);
+        });
+        for (std::size_t k = 0; k < count; ++k) order[k] = keys[k].index;
+        students.reorder(order);
+        return;
+    }
+
+    bool keyed = engine == SortKeyRadix;
+
+    if (keyed) {
+        std::vector<SortKey> keys(count);
+        for (std::size_t row = 0; row < count && keyed; ++row) {
+            keyed = makeSortKey(students.surnameData(row), students.surnameLength(row),
+                                students.firstNameData(row), students.firstNameLength(row),
+                                static_cast<uint32_t>(row), keys[row]);
+        }
+        if (keyed) {
+            sortDetail::finishKeySort(keys, less);
+            for (std::size_t k = 0; k < count; ++k) order[k] = keys[k].index;
+        }
+    }
+
+    if (!keyed) {
+        for (std::size_t row = 0; row < count; ++row) order[row] = static_cast<uint32_t>(row);
+        sortDetail::parallelMergeSort(order.begin(), order.end(), threads, less);
+    }
+
+    students.reorder(order);
+}
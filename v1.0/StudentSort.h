@@ -0,0 +1,487 @@
+#ifndef STUDENT_SORT_H
+#define STUDENT_SORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <stdexcept>
+#include <vector>
+#include <cstring>
+#include <stdint.h>
+
+#include "Parallel.h"
+#include "StudentTable.h"
+
+// -----------------------------------------------
+// Student sorting (surname, then first name – Person::operator<)
+//
+// With threads > 1 the data is cut into one run per thread,
+// every run is stable-sorted on its own thread, and the runs are
+// merged pairwise in rounds:
+//   vector / deque – merge sort through one buffer; each pair
+//                    of runs is split into independent sub-merges
+//                    (binary search on the second run) so every
+//                    round keeps all threads busy
+//   list           – runs are spliced off, list::sort-ed and
+//                    joined with list::merge (no element moves)
+// Every step is stable, so the result equals std::stable_sort /
+// list::sort for any thread count.
+// -----------------------------------------------
+namespace sortDetail {
+
+// Below this many elements per thread the threads cost more than
+// they save
+const std::size_t kMinRun = 4096;
+
+inline unsigned runCount(std::size_t count, unsigned threads)
+{
+    std::size_t runs = count / kMinRun;
+    if (runs > threads) runs = threads;
+    return runs < 1 ? 1u : static_cast<unsigned>(runs);
+}
+
+struct MergeTask {
+    std::size_t a, aEnd;        // slice of the left run
+    std::size_t b, bEnd;        // slice of the right run
+    std::size_t out;            // first output position
+};
+
+// One round: merge runs (0,1), (2,3), ... of "src" into "dst".
+// "bounds" holds the run edges and is replaced by the new ones.
+template <typename SrcIt, typename DstIt, typename Compare>
+void mergeRound(SrcIt src, DstIt dst, std::vector<std::size_t>& bounds,
+                unsigned threads, Compare comp)
+{
+    std::size_t runs = bounds.size() - 1;
+    std::size_t pairs = runs / 2;
+    std::size_t split = pairs > 0 && threads > pairs ? threads / pairs : 1;
+
+    std::vector<MergeTask> tasks;
+    std::vector<std::size_t> merged;
+    merged.push_back(0);
+
+    for (std::size_t p = 0; p < pairs; ++p) {
+        std::size_t lo = bounds[2 * p], mid = bounds[2 * p + 1], hi = bounds[2 * p + 2];
+        std::size_t a = lo, b = mid;
+
+        for (std::size_t s = 1; s <= split; ++s) {
+            std::size_t aCut = mid, bCut = hi;
+            if (s < split) {
+                // Everything in the right run that is smaller than
+                // src[aCut] goes in front of it (equal ones after)
+                aCut = lo + (mid - lo) * s / split;
+                bCut = aCut < mid
+                    ? static_cast<std::size_t>(std::lower_bound(src + b, src + hi, src[aCut], comp) - src)
+                    : hi;
+            }
+            MergeTask task = {a, aCut, b, bCut, a + (b - mid)};
+            tasks.push_back(task);
+            a = aCut;
+            b = bCut;
+        }
+        merged.push_back(hi);
+    }
+
+    if (runs % 2 != 0) {
+        // Odd run out: copied over unchanged
+        MergeTask task = {bounds[runs - 1], bounds[runs], bounds[runs], bounds[runs], bounds[runs - 1]};
+        tasks.push_back(task);
+        merged.push_back(bounds[runs]);
+    }
+
+    parallelFor(tasks.size(), threads, [&](std::size_t begin, std::size_t end, unsigned) {
+        for (std::size_t t = begin; t < end; ++t) {
+            const MergeTask& task = tasks[t];
+            std::merge(std::make_move_iterator(src + task.a), std::make_move_iterator(src + task.aEnd),
+                       std::make_move_iterator(src + task.b), std::make_move_iterator(src + task.bEnd),
+                       dst + task.out, comp);
+        }
+    });
+
+    bounds.swap(merged);
+}
+
+template <typename RandomIt, typename Compare>
+void parallelMergeSort(RandomIt first, RandomIt last, unsigned threads, Compare comp)
+{
+    typedef typename std::iterator_traits<RandomIt>::value_type Value;
+
+    std::size_t count = static_cast<std::size_t>(last - first);
+    unsigned runs = runCount(count, threads);
+    if (runs <= 1) {
+        std::stable_sort(first, last, comp);
+        return;
+    }
+
+    std::vector<std::size_t> bounds(runs + 1);
+    for (unsigned r = 0; r <= runs; ++r) bounds[r] = count * r / runs;
+
+    parallelFor(runs, runs, [&](std::size_t begin, std::size_t end, unsigned) {
+        for (std::size_t r = begin; r < end; ++r) {
+            std::stable_sort(first + bounds[r], first + bounds[r + 1], comp);
+        }
+    });
+
+    // Ping-pong between the container and the buffer
+    std::vector<Value> buffer(count);
+    bool inBuffer = false;
+    while (bounds.size() > 2) {
+        if (inBuffer) mergeRound(buffer.begin(), first, bounds, threads, comp);
+        else          mergeRound(first, buffer.begin(), bounds, threads, comp);
+        inBuffer = !inBuffer;
+    }
+
+    if (inBuffer) {
+        parallelFor(count, threads, [&](std::size_t begin, std::size_t end, unsigned) {
+            std::move(buffer.begin() + begin, buffer.begin() + end, first + begin);
+        });
+    }
+}
+
+template <typename T, typename A, typename Compare>
+void parallelListSort(std::list<T, A>& students, unsigned threads, Compare comp)
+{
+    std::size_t count = students.size();
+    unsigned runs = runCount(count, threads);
+    if (runs <= 1) {
+        students.sort(comp);
+        return;
+    }
+
+    // Splice the list into "runs" consecutive pieces
+    std::vector<std::list<T, A> > pieces;
+    pieces.reserve(runs);
+    for (unsigned r = 0; r < runs; ++r) {
+        std::size_t length = count * (r + 1) / runs - count * r / runs;
+        typename std::list<T, A>::iterator cut = students.begin();
+        std::advance(cut, length);
+
+        pieces.push_back(std::list<T, A>(students.get_allocator()));
+        pieces.back().splice(pieces.back().end(), students, students.begin(), cut);
+    }
+
+    parallelFor(runs, runs, [&](std::size_t begin, std::size_t end, unsigned) {
+        for (std::size_t r = begin; r < end; ++r) pieces[r].sort(comp);
+    });
+
+    // Pairwise merges; list::merge keeps the left piece first on ties
+    while (pieces.size() > 1) {
+        std::size_t pairs = pieces.size() / 2;
+        parallelFor(pairs, threads, [&](std::size_t begin, std::size_t end, unsigned) {
+            for (std::size_t p = begin; p < end; ++p) {
+                pieces[2 * p].merge(pieces[2 * p + 1], comp);
+            }
+        });
+
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < pieces.size(); i += 2) pieces[kept++].swap(pieces[i]);
+        pieces.erase(pieces.begin() + kept, pieces.end());
+    }
+
+    students.splice(students.end(), pieces[0]);
+}
+
+} // namespace sortDetail
+
+// -----------------------------------------------
+// Key-prefix radix sort
+//
+// Every student gets a 16-byte key: the surname, a 0 byte, then
+// the first name, cut or zero-padded to 16 bytes and read
+// big-endian as two uint64. Comparing keys gives the same answer
+// as Person::operator< unless the keys are equal, so the
+// (key, index) pairs are sorted with a stable LSD radix sort
+// (byte positions that are the same in every key are skipped)
+// and only runs of equal keys are finished with full compares.
+// The order is then applied once: moves for vector / deque,
+// splices for list, a column shuffle for StudentTable.
+//
+// Natural order works the same way on the first 16 bytes of the
+// precomputed Person::getNaturalKey() (see Collation.h).
+// -----------------------------------------------
+struct SortKey {
+    uint64_t hi;
+    uint64_t lo;
+    uint32_t index;
+};
+
+inline void packSortKey(const unsigned char* bytes, uint32_t index, SortKey& key)
+{
+    key.hi = 0;
+    key.lo = 0;
+    for (int i = 0; i < 8; ++i) key.hi = (key.hi << 8) | bytes[i];
+    for (int i = 8; i < 16; ++i) key.lo = (key.lo << 8) | bytes[i];
+    key.index = index;
+}
+
+// False if the surname holds a 0 byte (the key would not match
+// the string order; callers fall back to the comparison sort)
+inline bool makeSortKey(const char* surname, std::size_t surnameLength,
+                        const char* firstName, std::size_t firstLength,
+                        uint32_t index, SortKey& key)
+{
+    unsigned char bytes[16] = {0};
+    std::size_t used = surnameLength < 16 ? surnameLength : 16;
+    std::memcpy(bytes, surname, used);
+    if (used < 15) {
+        // bytes[used] stays 0 as the separator
+        std::size_t room = 15 - used;
+        std::memcpy(bytes + used + 1, firstName, firstLength < room ? firstLength : room);
+    }
+    packSortKey(bytes, index, key);
+
+    return std::memchr(surname, 0, surnameLength) == NULL;
+}
+
+// Zero-padded prefix of one byte string (always order-preserving)
+inline void makePrefixKey(const char* text, std::size_t length, uint32_t index, SortKey& key)
+{
+    unsigned char bytes[16] = {0};
+    std::memcpy(bytes, text, length < 16 ? length : 16);
+    packSortKey(bytes, index, key);
+}
+
+inline bool sameKey(const SortKey& a, const SortKey& b)
+{
+    return a.hi == b.hi && a.lo == b.lo;
+}
+
+// Stable LSD radix sort on (hi, lo)
+void radixSortKeys(std::vector<SortKey>& keys);
+
+// Natural order of two students: precomputed keys, then
+// Person::operator< for names whose keys are equal
+struct NaturalLess {
+    template <typename T>
+    bool operator()(const T& a, const T& b) const
+    {
+        int byKey = a.getNaturalKey().compare(b.getNaturalKey());
+        if (byKey != 0) return byKey < 0;
+        return a < b;
+    }
+};
+
+namespace sortDetail {
+
+// Radix sort "keys", then stable-sort each run of equal keys with
+// "less" (full compare of two indices)
+template <typename Less>
+void finishKeySort(std::vector<SortKey>& keys, Less less)
+{
+    radixSortKeys(keys);
+
+    std::size_t start = 0;
+    while (start < keys.size()) {
+        std::size_t end = start + 1;
+        while (end < keys.size() && sameKey(keys[start], keys[end])) ++end;
+        if (end - start > 1) {
+            std::stable_sort(keys.begin() + start, keys.begin() + end,
+                             [&less](const SortKey& a, const SortKey& b) {
+                                 return less(a.index, b.index);
+                             });
+        }
+        start = end;
+    }
+}
+
+inline void checkKeyCount(std::size_t count)
+{
+    if (count > 0xFFFFFFFFu) {
+        throw std::length_error("sortStudents: too many students for radix sort");
+    }
+}
+
+// Build missing natural keys (once per student)
+template <typename Container>
+void ensureNaturalKeys(Container& students)
+{
+    for (typename Container::iterator it = students.begin(); it != students.end(); ++it) {
+        if (it->getNaturalKey().empty()) it->buildNaturalKey();
+    }
+}
+
+} // namespace sortDetail
+
+// Precompute every student's natural key, e.g. right after loading
+// (SortNatural builds missing keys itself)
+template <typename Container>
+void buildNaturalKeys(Container& students)
+{
+    for (typename Container::iterator it = students.begin(); it != students.end(); ++it) {
+        it->buildNaturalKey();
+    }
+}
+
+namespace sortDetail {
+
+// Keys for a random-access sequence of Person; false if some
+// surname cannot be keyed (natural keys always can)
+template <typename RandomIt>
+bool buildPersonKeys(RandomIt first, std::size_t count, unsigned threads,
+                     bool natural, std::vector<SortKey>& keys)
+{
+    checkKeyCount(count);
+    keys.resize(count);
+    std::vector<char> usable(threads < 1 ? 1 : threads, 1);
+
+    parallelFor(count, threads, [&](std::size_t begin, std::size_t end, unsigned part) {
+        for (std::size_t i = begin; i < end; ++i) {
+            uint32_t index = static_cast<uint32_t>(i);
+            if (natural) {
+                const std::string& key = first[i].getNaturalKey();
+                makePrefixKey(key.data(), key.size(), index, keys[i]);
+                continue;
+            }
+            const std::string& surname = first[i].getSurname();
+            const std::string& firstName = first[i].getFirstName();
+            if (!makeSortKey(surname.data(), surname.size(), firstName.data(),
+                             firstName.size(), index, keys[i])) {
+                usable[part] = 0;
+            }
+        }
+    });
+    return std::find(usable.begin(), usable.end(), 0) == usable.end();
+}
+
+template <typename T, typename A>
+void reserveFor(std::vector<T, A>& students, std::size_t count)
+{
+    students.reserve(count);
+}
+
+template <typename Sequence>
+void reserveFor(Sequence&, std::size_t) {}
+
+// vector / deque: sort the keys, then move every element once
+template <typename Sequence>
+void radixSortSequence(Sequence& students, unsigned threads, bool natural)
+{
+    typedef typename Sequence::value_type Value;
+
+    if (natural) ensureNaturalKeys(students);
+
+    std::vector<SortKey> keys;
+    if (!buildPersonKeys(students.begin(), students.size(), threads, natural, keys)) {
+        parallelMergeSort(students.begin(), students.end(), threads, std::less<Value>());
+        return;
+    }
+
+    if (natural) {
+        NaturalLess less;
+        finishKeySort(keys, [&students, &less](uint32_t a, uint32_t b) {
+            return less(students[a], students[b]);
+        });
+    } else {
+        finishKeySort(keys, [&students](uint32_t a, uint32_t b) {
+            return students[a] < students[b];
+        });
+    }
+
+    Sequence sorted(students.get_allocator());
+    reserveFor(sorted, keys.size());
+    for (std::size_t k = 0; k < keys.size(); ++k) {
+        sorted.push_back(std::move(students[keys[k].index]));
+    }
+    students.swap(sorted);
+}
+
+// list: sort the keys, then splice the nodes into place
+template <typename T, typename A>
+void radixSortList(std::list<T, A>& students, unsigned threads, bool natural)
+{
+    typedef typename std::list<T, A>::iterator Iterator;
+
+    if (natural) ensureNaturalKeys(students);
+
+    std::vector<Iterator> nodes;
+    nodes.reserve(students.size());
+    for (Iterator it = students.begin(); it != students.end(); ++it) nodes.push_back(it);
+
+    struct NodeValue {
+        const std::vector<Iterator>* nodes;
+        const T& operator[](std::size_t i) const { return *(*nodes)[i]; }
+    };
+    NodeValue values = {&nodes};
+
+    std::vector<SortKey> keys;
+    if (!buildPersonKeys(values, nodes.size(), threads, natural, keys)) {
+        parallelListSort(students, threads, std::less<T>());
+        return;
+    }
+
+    if (natural) {
+        NaturalLess less;
+        finishKeySort(keys, [&values, &less](uint32_t a, uint32_t b) {
+            return less(values[a], values[b]);
+        });
+    } else {
+        finishKeySort(keys, [&values](uint32_t a, uint32_t b) {
+            return values[a] < values[b];
+        });
+    }
+
+    for (std::size_t k = 0; k < keys.size(); ++k) {
+        students.splice(students.end(), students, nodes[keys[k].index]);
+    }
+}
+
+} // namespace sortDetail
+
+// -----------------------------------------------
+// sortStudents – one entry point for every container
+//   SortComparison – Person::operator< (parallel merge sort above)
+//   SortKeyRadix   – key-prefix radix sort, same order
+//   SortNatural    – natural order ("Name9" before "Name10"),
+//                    key-prefix radix sort on the natural keys
+// All of them are stable.
+// -----------------------------------------------
+enum SortEngine {
+    SortComparison,
+    SortKeyRadix,
+    SortNatural
+};
+
+template <typename T, typename A>
+void sortStudents(std::vector<T, A>& students, SortEngine engine, unsigned threads = 1)
+{
+    if (engine == SortComparison) {
+        sortDetail::parallelMergeSort(students.begin(), students.end(), threads, std::less<T>());
+    } else {
+        sortDetail::radixSortSequence(students, threads, engine == SortNatural);
+    }
+}
+
+template <typename T, typename A>
+void sortStudents(std::deque<T, A>& students, SortEngine engine, unsigned threads = 1)
+{
+    if (engine == SortComparison) {
+        sortDetail::parallelMergeSort(students.begin(), students.end(), threads, std::less<T>());
+    } else {
+        sortDetail::radixSortSequence(students, threads, engine == SortNatural);
+    }
+}
+
+template <typename T, typename A>
+void sortStudents(std::list<T, A>& students, SortEngine engine, unsigned threads = 1)
+{
+    if (engine == SortComparison) {
+        sortDetail::parallelListSort(students, threads, std::less<T>());
+    } else {
+        sortDetail::radixSortList(students, threads, engine == SortNatural);
+    }
+}
+
+// StudentTable stores no natural keys; SortNatural builds them
+// for the duration of the sort
+void sortStudents(StudentTable& students, SortEngine engine, unsigned threads = 1);
+
+template <typename Container>
+void sortStudents(Container& students, unsigned threads = 1)
+{
+    sortStudents(students, SortComparison, threads);
+}
+
+#endif // STUDENT_SORT_H
@@ -0,0 +1,215 @@
+#include "StudentTable.h"
+#include "GradeKernels.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+StudentTable::StudentTable(std::size_t homeworkCount)
+    : hwCount(homeworkCount)
+{
+    nameOffsets.push_back(0);
+}
+
+void StudentTable::clear()
+{
+    homework.clear();
+    exam.clear();
+    finalGrades.clear();
+    names.clear();
+    nameOffsets.assign(1, 0);
+}
+
+void StudentTable::reserve(std::size_t rows, std::size_t nameBytesPerRow)
+{
+    homework.reserve(rows * hwCount);
+    exam.reserve(rows);
+    finalGrades.reserve(rows);
+    names.reserve(rows * nameBytesPerRow);
+    nameOffsets.reserve(2 * rows + 1);
+}
+
+void StudentTable::addStudent(const char* firstName, std::size_t firstLength,
+                              const char* surname, std::size_t surnameLength,
+                              const uint8_t* homeworkScores, uint8_t examScore,
+                              double finalGrade)
+{
+    if (names.size() + firstLength + surnameLength >
+        std::numeric_limits<uint32_t>::max()) {
+        throw std::length_error("StudentTable name pool is full (4 GB)");
+    }
+
+    names.append(firstName, firstLength);
+    nameOffsets.push_back(static_cast<uint32_t>(names.size()));
+    names.append(surname, surnameLength);
+    nameOffsets.push_back(static_cast<uint32_t>(names.size()));
+
+    homework.insert(homework.end(), homeworkScores, homeworkScores + hwCount);
+    exam.push_back(examScore);
+    finalGrades.push_back(finalGrade);
+}
+
+void StudentTable::addStudent(const Person& person)
+{
+    const Person::HomeworkScores& scores = person.getHomeworkScores();
+    if (scores.size() != hwCount) {
+        throw std::invalid_argument("StudentTable: wrong number of homework scores");
+    }
+
+    std::vector<uint8_t> row(hwCount);
+    for (std::size_t i = 0; i < hwCount; ++i) {
+        if (scores[i] < 0 || scores[i] > 255) {
+            throw std::invalid_argument("StudentTable: score out of range");
+        }
+        row[i] = static_cast<uint8_t>(scores[i]);
+    }
+    if (person.getExamScore() < 0 || person.getExamScore() > 255) {
+        throw std::invalid_argument("StudentTable: score out of range");
+    }
+
+    const std::string& first = person.getFirstName();
+    const std::string& last  = person.getSurname();
+    addStudent(first.data(), first.size(), last.data(), last.size(),
+               row.empty() ? NULL : &row[0],
+               static_cast<uint8_t>(person.getExamScore()),
+               person.getFinalGrade());
+}
+
+void StudentTable::appendRow(const StudentTable& other, std::size_t row)
+{
+    addStudent(other.firstNameData(row), other.firstNameLength(row),
+               other.surnameData(row), other.surnameLength(row),
+               other.homeworkRow(row), other.exam[row],
+               other.finalGrades[row]);
+}
+
+void StudentTable::append(const StudentTable& other)
+{
+    if (other.hwCount != hwCount) {
+        throw std::invalid_argument("StudentTable: different homework counts");
+    }
+    if (names.size() + other.names.size() > std::numeric_limits<uint32_t>::max()) {
+        throw std::length_error("StudentTable name pool is full (4 GB)");
+    }
+
+    // Columns are copied in bulk; name offsets are shifted by the
+    // current size of the name pool
+    uint32_t shift = static_cast<uint32_t>(names.size());
+    for (std::size_t i = 1; i < other.nameOffsets.size(); ++i) {
+        nameOffsets.push_back(other.nameOffsets[i] + shift);
+    }
+    names += other.names;
+    homework.insert(homework.end(), other.homework.begin(), other.homework.end());
+    exam.insert(exam.end(), other.exam.begin(), other.exam.end());
+    finalGrades.insert(finalGrades.end(), other.finalGrades.begin(), other.finalGrades.end());
+}
+
+void StudentTable::swap(StudentTable& other)
+{
+    std::swap(hwCount, other.hwCount);
+    homework.swap(other.homework);
+    exam.swap(other.exam);
+    finalGrades.swap(other.finalGrades);
+    names.swap(other.names);
+    nameOffsets.swap(other.nameOffsets);
+}
+
+void StudentTable::reorder(const std::vector<uint32_t>& order)
+{
+    StudentTable sorted(hwCount);
+    sorted.homework.resize(homework.size());
+    sorted.exam.resize(exam.size());
+    sorted.finalGrades.resize(finalGrades.size());
+    sorted.names.reserve(names.size());
+    sorted.nameOffsets.reserve(nameOffsets.size());
+
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        std::size_t row = order[i];
+        if (hwCount > 0) {
+            std::memcpy(&sorted.homework[i * hwCount], &homework[row * hwCount], hwCount);
+        }
+        sorted.exam[i] = exam[row];
+        sorted.finalGrades[i] = finalGrades[row];
+
+        sorted.names.append(names, nameOffsets[2 * row], nameOffsets[2 * row + 2] - nameOffsets[2 * row]);
+        sorted.nameOffsets.push_back(static_cast<uint32_t>(sorted.names.size() - surnameLength(row)));
+        sorted.nameOffsets.push_back(static_cast<uint32_t>(sorted.names.size()));
+    }
+    swap(sorted);
+}
+
+void StudentTable::assign(std::size_t homeworkCount, std::size_t rows,
+                          const uint8_t* homeworkScores, const uint8_t* examScores,
+                          const double* grades, const char* pool,
+                          const uint32_t* offsets)
+{
+    hwCount = homeworkCount;
+    homework.assign(homeworkScores, homeworkScores + rows * homeworkCount);
+    exam.assign(examScores, examScores + rows);
+    if (grades != NULL) finalGrades.assign(grades, grades + rows);
+    else                finalGrades.assign(rows, 0.0);
+    names.assign(pool, offsets[2 * rows]);
+    nameOffsets.assign(offsets, offsets + 2 * rows + 1);
+}
+
+void StudentTable::calculateFinalGradesAverage()
+{
+    ::calculateFinalGradesAverage(homeworkData(), examData(), size(),
+                                  hwCount, finalGradeData());
+}
+
+void StudentTable::calculateFinalGradesMedian()
+{
+    ::calculateFinalGradesMedian(homeworkData(), examData(), size(),
+                                 hwCount, finalGradeData());
+}
+
+void StudentTable::moveFailedTo(StudentTable& failed, double threshold)
+{
+    // Single forward pass: passed rows slide down to "kept",
+    // failed rows are appended to the other table.
+    // Writing never overtakes reading, so the columns and the
+    // name pool can be compacted in place.
+    std::size_t kept = 0;
+    std::size_t nameEnd = 0;
+
+    for (std::size_t row = 0; row < size(); ++row) {
+        if (finalGrades[row] < threshold) {
+            failed.appendRow(*this, row);
+            continue;
+        }
+
+        if (kept != row) {
+            std::memmove(&homework[kept * hwCount], &homework[row * hwCount], hwCount);
+            exam[kept] = exam[row];
+            finalGrades[kept] = finalGrades[row];
+
+            uint32_t start  = nameOffsets[2 * row];
+            uint32_t middle = nameOffsets[2 * row + 1];
+            uint32_t end    = nameOffsets[2 * row + 2];
+            std::memmove(&names[nameEnd], &names[start], end - start);
+            nameOffsets[2 * kept + 1] = static_cast<uint32_t>(nameEnd + (middle - start));
+            nameOffsets[2 * kept + 2] = static_cast<uint32_t>(nameEnd + (end - start));
+        }
+        nameEnd = nameOffsets[2 * kept + 2];
+        ++kept;
+    }
+
+    homework.resize(kept * hwCount);
+    exam.resize(kept);
+    finalGrades.resize(kept);
+    names.resize(nameEnd);
+    nameOffsets.resize(2 * kept + 1);
+}
+
+Person StudentTable::toPerson(std::size_t row) const
+{
+    Person person(getFirstName(row), getSurname(row));
+    const uint8_t* scores = homeworkRow(row);
+    person.reserveHomeworkScores(hwCount);
+    for (std::size_t i = 0; i < hwCount; ++i) person.addHomeworkScore(scores[i]);
+    person.setExamScore(exam[row]);
+    person.calculateFinalGradeAverage();
+    return person;
+}
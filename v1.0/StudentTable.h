@@ -0,0 +1,127 @@
+#ifndef STUDENT_TABLE_H
+#define STUDENT_TABLE_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <stdint.h>
+
+#include "Person.h"
+
+// -----------------------------------------------
+// StudentTable – columnar (struct-of-arrays) storage
+//
+// Instead of one Person object per student (two strings and a
+// vector on the heap each), all students share a few contiguous
+// columns:
+//   homework    – uint8 score matrix, row-major, homeworkCount() per row
+//   exam        – uint8 exam score per row
+//   finalGrades – double final grade per row
+//   names       – one character pool holding every name back to back,
+//                 nameOffsets[2*i] .. [2*i+1] is the first name of row i,
+//                 nameOffsets[2*i+1] .. [2*i+2] is the surname
+// -----------------------------------------------
+class StudentTable {
+private:
+    std::size_t hwCount;
+    std::vector<uint8_t> homework;
+    std::vector<uint8_t> exam;
+    std::vector<double> finalGrades;
+    std::string names;
+    std::vector<uint32_t> nameOffsets;
+
+public:
+    explicit StudentTable(std::size_t homeworkCount = 15);
+
+    std::size_t size() const { return exam.size(); }
+    bool empty() const { return exam.empty(); }
+    std::size_t homeworkCount() const { return hwCount; }
+
+    void clear();
+    void reserve(std::size_t rows, std::size_t nameBytesPerRow = 24);
+
+    // Append one row (homework must hold homeworkCount() scores)
+    void addStudent(const char* firstName, std::size_t firstLength,
+                    const char* surname, std::size_t surnameLength,
+                    const uint8_t* homeworkScores, uint8_t examScore,
+                    double finalGrade = 0.0);
+    void addStudent(const Person& person);
+
+    // Copy row "row" of another table (same homework count) to the end
+    void appendRow(const StudentTable& other, std::size_t row);
+
+    // Copy all rows of another table (same homework count) to the end
+    void append(const StudentTable& other);
+
+    void swap(StudentTable& other);
+
+    // Rearrange the rows: new row i is old row order[i]
+    // ("order" must be a permutation of 0 .. size() - 1)
+    void reorder(const std::vector<uint32_t>& order);
+
+    // Replace the whole table with columns in the layout above
+    // (bulk copies, no per-row work). finalGrades may be NULL (all 0).
+    void assign(std::size_t homeworkCount, std::size_t rows,
+                const uint8_t* homeworkScores, const uint8_t* examScores,
+                const double* grades, const char* pool,
+                const uint32_t* offsets);
+
+    // Column access
+    const uint8_t* homeworkRow(std::size_t row) const { return &homework[row * hwCount]; }
+    const uint8_t* homeworkData() const { return homework.empty() ? NULL : &homework[0]; }
+    const uint8_t* examData() const { return exam.empty() ? NULL : &exam[0]; }
+    double* finalGradeData() { return finalGrades.empty() ? NULL : &finalGrades[0]; }
+    const double* finalGradeData() const { return finalGrades.empty() ? NULL : &finalGrades[0]; }
+    int examScore(std::size_t row) const { return exam[row]; }
+    double finalGrade(std::size_t row) const { return finalGrades[row]; }
+
+    const char* firstNameData(std::size_t row) const { return names.data() + nameOffsets[2 * row]; }
+    std::size_t firstNameLength(std::size_t row) const { return nameOffsets[2 * row + 1] - nameOffsets[2 * row]; }
+    const char* surnameData(std::size_t row) const { return names.data() + nameOffsets[2 * row + 1]; }
+    std::size_t surnameLength(std::size_t row) const { return nameOffsets[2 * row + 2] - nameOffsets[2 * row + 1]; }
+    std::string getFirstName(std::size_t row) const { return std::string(firstNameData(row), firstNameLength(row)); }
+    std::string getSurname(std::size_t row) const { return std::string(surnameData(row), surnameLength(row)); }
+
+    // Name pool and its 2 * size() + 1 offsets
+    const char* namePool() const { return names.data(); }
+    std::size_t namePoolSize() const { return names.size(); }
+    const uint32_t* nameOffsetData() const { return &nameOffsets[0]; }
+
+    // Grade every row: 0.4 * average(homework) + 0.6 * exam
+    // (batch SIMD kernel, bit-identical to Person::calculateFinalGradeAverage)
+    void calculateFinalGradesAverage();
+
+    // Grade every row: 0.4 * median(homework) + 0.6 * exam
+    void calculateFinalGradesMedian();
+
+    // Move rows with finalGrade < threshold to "failed" (appended),
+    // keeping the order of both the remaining and the moved rows
+    void moveFailedTo(StudentTable& failed, double threshold = 5.0);
+
+    // Convert one row back to a Person
+    Person toPerson(std::size_t row) const;
+};
+
+// -----------------------------------------------
+// StudentTableRow – handle to one row of a table (table
+// pointer + row number), for code that reads a row without
+// turning it into a Person (StudentTableView, StudentWriter)
+// -----------------------------------------------
+class StudentTableRow {
+private:
+    const StudentTable* table;
+    std::size_t rowIndex;
+
+public:
+    StudentTableRow(const StudentTable& table, std::size_t row) : table(&table), rowIndex(row) {}
+
+    std::size_t row() const { return rowIndex; }
+    const char* firstNameData() const { return table->firstNameData(rowIndex); }
+    std::size_t firstNameLength() const { return table->firstNameLength(rowIndex); }
+    const char* surnameData() const { return table->surnameData(rowIndex); }
+    std::size_t surnameLength() const { return table->surnameLength(rowIndex); }
+    int getExamScore() const { return table->examScore(rowIndex); }
+    double getFinalGrade() const { return table->finalGrade(rowIndex); }
+};
+
+#endif // STUDENT_TABLE_H
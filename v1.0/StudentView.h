@@ -0,0 +1,182 @@
+#ifndef STUDENT_VIEW_H
+#define STUDENT_VIEW_H
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+#include <stdint.h>
+
+#include "GradeKernels.h"
+#include "StudentPartition.h"
+#include "StudentTable.h"
+
+// -----------------------------------------------
+// StudentView<T> – read-only list of students that live in
+// another container
+//
+// Only a pointer per student is stored (8 bytes instead of a
+// Person with two strings and a vector). It iterates like a
+// container of T, so writeStudentsToFile and other read-only
+// code take it as is. A view is valid as long as the base
+// container is alive and not modified (vector/deque must not
+// grow, shrink or be reordered; list elements must not be
+// erased).
+// -----------------------------------------------
+template <typename T>
+class StudentView {
+private:
+    typedef std::vector<const T*> Rows;
+    Rows rows;
+
+public:
+    typedef T value_type;
+    typedef const T& const_reference;
+    typedef std::size_t size_type;
+
+    class const_iterator {
+    private:
+        typename Rows::const_iterator it;
+
+    public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T* pointer;
+        typedef const T& reference;
+
+        const_iterator() {}
+        explicit const_iterator(typename Rows::const_iterator it) : it(it) {}
+
+        reference operator*() const { return **it; }
+        pointer operator->() const { return *it; }
+        const_iterator& operator++() { ++it; return *this; }
+        const_iterator operator++(int) { const_iterator old = *this; ++it; return old; }
+        const_iterator& operator--() { --it; return *this; }
+        const_iterator operator--(int) { const_iterator old = *this; --it; return old; }
+        bool operator==(const const_iterator& other) const { return it == other.it; }
+        bool operator!=(const const_iterator& other) const { return it != other.it; }
+    };
+    typedef const_iterator iterator;
+
+    std::size_t size() const { return rows.size(); }
+    bool empty() const { return rows.empty(); }
+    void clear() { rows.clear(); }
+    void reserve(std::size_t count) { rows.reserve(count); }
+    void push_back(const T& student) { rows.push_back(&student); }
+
+    const T& operator[](std::size_t i) const { return *rows[i]; }
+    const_iterator begin() const { return const_iterator(rows.begin()); }
+    const_iterator end() const { return const_iterator(rows.end()); }
+
+    // Heap bytes held by the view itself
+    std::size_t memoryBytes() const { return rows.capacity() * sizeof(const T*); }
+};
+
+// -----------------------------------------------
+// View split: same passed/failed order as Strategies 1-3,
+// but no student is copied or moved. The pass mask gives
+// the exact sizes, so each view allocates once.
+// -----------------------------------------------
+template <typename Container, typename Predicate>
+void splitView(const Container& students,
+               StudentView<typename Container::value_type>& passed,
+               StudentView<typename Container::value_type>& failed,
+               Predicate isPassed)
+{
+    std::vector<uint8_t> mask;
+    std::size_t passedCount = buildPassMask(students, isPassed, mask);
+    passed.reserve(passed.size() + passedCount);
+    failed.reserve(failed.size() + students.size() - passedCount);
+
+    std::size_t i = 0;
+    for (typename Container::const_iterator it = students.begin();
+         it != students.end(); ++it, ++i) {
+        if (mask[i]) passed.push_back(*it);
+        else         failed.push_back(*it);
+    }
+}
+
+// -----------------------------------------------
+// StudentTableView – the same for a StudentTable: the row
+// numbers of the base table (4 bytes per student). Iterating
+// yields StudentTableRow handles, which StudentWriter writes
+// directly, so writeStudentsToFile takes a table view too.
+// Valid while the base table is alive and unchanged.
+// -----------------------------------------------
+class StudentTableView {
+private:
+    typedef std::vector<uint32_t> Rows;
+    const StudentTable* table;
+    Rows rows;
+
+public:
+    typedef StudentTableRow value_type;
+    typedef StudentTableRow const_reference;
+    typedef std::size_t size_type;
+
+    // Yields rows by value (a proxy, like vector<bool>)
+    class const_iterator {
+    private:
+        const StudentTable* table;
+        Rows::const_iterator it;
+
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef StudentTableRow value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const StudentTableRow* pointer;
+        typedef StudentTableRow reference;
+
+        const_iterator() : table(NULL) {}
+        const_iterator(const StudentTable* table, Rows::const_iterator it) : table(table), it(it) {}
+
+        reference operator*() const { return StudentTableRow(*table, *it); }
+        const_iterator& operator++() { ++it; return *this; }
+        const_iterator operator++(int) { const_iterator old = *this; ++it; return old; }
+        bool operator==(const const_iterator& other) const { return it == other.it; }
+        bool operator!=(const const_iterator& other) const { return it != other.it; }
+    };
+    typedef const_iterator iterator;
+
+    StudentTableView() : table(NULL) {}
+    explicit StudentTableView(const StudentTable& table) : table(&table) {}
+
+    const StudentTable* base() const { return table; }
+    std::size_t size() const { return rows.size(); }
+    bool empty() const { return rows.empty(); }
+    void clear() { rows.clear(); }
+    void reserve(std::size_t count) { rows.reserve(count); }
+    void push_back(std::size_t row) { rows.push_back(static_cast<uint32_t>(row)); }
+
+    StudentTableRow operator[](std::size_t i) const { return StudentTableRow(*table, rows[i]); }
+    const_iterator begin() const { return const_iterator(table, rows.begin()); }
+    const_iterator end() const { return const_iterator(table, rows.end()); }
+
+    // Heap bytes held by the view itself
+    std::size_t memoryBytes() const { return rows.capacity() * sizeof(uint32_t); }
+};
+
+// View split of a table on its final grade column: one
+// counting pass, exact reserve, then one pass over the rows.
+// Both views are (re)bound to "students".
+inline void splitView(const StudentTable& students,
+                      StudentTableView& passed, StudentTableView& failed,
+                      double threshold = kPassThreshold)
+{
+    passed = StudentTableView(students);
+    failed = StudentTableView(students);
+
+    std::size_t passedCount = 0;
+    for (std::size_t row = 0; row < students.size(); ++row) {
+        passedCount += students.finalGrade(row) >= threshold ? 1 : 0;
+    }
+    passed.reserve(passedCount);
+    failed.reserve(students.size() - passedCount);
+
+    for (std::size_t row = 0; row < students.size(); ++row) {
+        if (students.finalGrade(row) >= threshold) passed.push_back(row);
+        else                                       failed.push_back(row);
+    }
+}
+
+#endif // STUDENT_VIEW_H
@@ -0,0 +1,468 @@
+// -----------------------------------------------
+// student_grading_bench – microbenchmarks for v1.0
+//
+// Times the per-student building blocks (grading, comparison,
+// output, generation) and the split strategies over a grid of
+// student counts and homework counts, with the harness from
+// Benchmark.h. Results can be saved as a JSON baseline and a
+// later run (e.g. on another commit) compared against it:
+//
+//   student_grading_bench --output base.json
+//   student_grading_bench --baseline base.json --max-regression 10
+//
+// The second run exits with code 1 if any benchmark's median
+// is more than 10% slower than in the baseline, by more than
+// the baseline and current MADs together.
+// -----------------------------------------------
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <list>
+#include <deque>
+#include <map>
+#include <string>
+#include <stdexcept>
+#include <cerrno>
+#include <cstdlib>
+
+#include "Person.h"
+#include "StudentGenerator.h"
+#include "SplitStrategies.h"
+#include "Benchmark.h"
+
+using namespace std;
+
+// -----------------------------------------------
+// Options
+// -----------------------------------------------
+struct BenchOptions
+{
+    vector<size_t> sizes;
+    vector<size_t> homeworkCounts;
+    unsigned warmup;
+    unsigned reps;
+    int pinCpu;
+    uint64_t seed;
+    string filter;              // run only names containing this
+    string outputFile;          // JSON results
+    string baselineFile;        // JSON results of an earlier run
+    double maxRegression;       // percent; < 0 = only report
+
+    BenchOptions()
+        : warmup(1), reps(5), pinCpu(-1), seed(42), maxRegression(-1.0)
+    {
+        sizes.push_back(1000);
+        sizes.push_back(10000);
+        sizes.push_back(100000);
+        homeworkCounts.push_back(5);
+        homeworkCounts.push_back(15);
+        homeworkCounts.push_back(50);
+    }
+};
+
+void printUsage(ostream& out, const char* program)
+{
+    out << "Usage: " << program << " [options]\n\n"
+        << "  --sizes LIST          student counts (default 1000,10000,100000)\n"
+        << "  --homework LIST       homework counts (default 5,15,50)\n"
+        << "  --reps N              timed trials per benchmark (default 5)\n"
+        << "  --warmup N            untimed runs before the trials (default 1)\n"
+        << "  --pin CPU             run on this CPU\n"
+        << "  --seed N              generator seed (default 42)\n"
+        << "  --filter TEXT         only benchmarks whose name contains TEXT\n"
+        << "  --output FILE         write the results as JSON (a baseline)\n"
+        << "  --baseline FILE       compare with the results of an earlier run\n"
+        << "  --max-regression PCT  exit with 1 if a median is more than PCT %\n"
+        << "                        slower than in the baseline and the slowdown\n"
+        << "                        is larger than the two MADs together\n";
+}
+
+uint64_t parseNumber(const string& flag, const string& value)
+{
+    char* end = NULL;
+    errno = 0;
+    unsigned long long number = strtoull(value.c_str(), &end, 10);
+    if (value.empty() || value[0] == '-' || *end != '\0' || errno == ERANGE)
+    {
+        throw runtime_error(flag + ": expected a non-negative number, got \"" + value + "\"");
+    }
+    return number;
+}
+
+double parsePercent(const string& flag, const string& value)
+{
+    char* end = NULL;
+    errno = 0;
+    double number = strtod(value.c_str(), &end);
+    if (value.empty() || *end != '\0' || errno == ERANGE || !(number >= 0.0))
+    {
+        throw runtime_error(flag + ": expected a non-negative percentage, got \"" + value + "\"");
+    }
+    return number;
+}
+
+vector<size_t> parseList(const string& flag, const string& value)
+{
+    vector<size_t> numbers;
+    stringstream in(value);
+    string item;
+    while (getline(in, item, ','))
+    {
+        if (!item.empty()) numbers.push_back(static_cast<size_t>(parseNumber(flag, item)));
+    }
+    if (numbers.empty()) throw runtime_error(flag + ": empty list");
+    return numbers;
+}
+
+BenchOptions parseOptions(int argc, char* argv[])
+{
+    BenchOptions options;
+    for (int i = 1; i < argc; ++i)
+    {
+        string flag = argv[i];
+        if (flag == "--help" || flag == "-h")
+        {
+            printUsage(cout, argv[0]);
+            exit(0);
+        }
+        if (i + 1 >= argc) throw runtime_error(flag + ": missing value");
+        string value = argv[++i];
+
+        if (flag == "--sizes")               options.sizes = parseList(flag, value);
+        else if (flag == "--homework")       options.homeworkCounts = parseList(flag, value);
+        else if (flag == "--reps")           options.reps = static_cast<unsigned>(parseNumber(flag, value));
+        else if (flag == "--warmup")         options.warmup = static_cast<unsigned>(parseNumber(flag, value));
+        else if (flag == "--pin")            options.pinCpu = static_cast<int>(parseNumber(flag, value));
+        else if (flag == "--seed")           options.seed = parseNumber(flag, value);
+        else if (flag == "--filter")         options.filter = value;
+        else if (flag == "--output")         options.outputFile = value;
+        else if (flag == "--baseline")       options.baselineFile = value;
+        else if (flag == "--max-regression") options.maxRegression = parsePercent(flag, value);
+        else throw runtime_error("unknown flag \"" + flag + "\"");
+    }
+    if (options.reps == 0) throw runtime_error("--reps: must be at least 1");
+    if (options.maxRegression >= 0 && options.baselineFile.empty())
+    {
+        throw runtime_error("--max-regression needs --baseline");
+    }
+    return options;
+}
+
+// -----------------------------------------------
+// Results
+// -----------------------------------------------
+struct BenchResult
+{
+    string name;
+    size_t n;
+    size_t homework;
+    BenchmarkStats stats;
+};
+
+string formatNs(double ns)
+{
+    ostringstream out;
+    out << fixed << setprecision(ns < 1e3 ? 0 : 2);
+    if (ns >= 1e9)      out << ns / 1e9 << " s";
+    else if (ns >= 1e6) out << ns / 1e6 << " ms";
+    else if (ns >= 1e3) out << ns / 1e3 << " us";
+    else                out << ns << " ns";
+    return out.str();
+}
+
+class BenchRunner
+{
+private:
+    const BenchOptions& options;
+    BenchmarkOptions bench;
+    vector<BenchResult> results;
+
+public:
+    explicit BenchRunner(const BenchOptions& options)
+        : options(options), bench(options.warmup, options.reps, options.pinCpu) {}
+
+    bool wanted(const string& name) const
+    {
+        return options.filter.empty() || name.find(options.filter) != string::npos;
+    }
+
+    template <typename Setup, typename Work>
+    void run(const string& base, size_t n, size_t homework, Setup setup, Work work)
+    {
+        string name = base + "/hw=" + to_string(homework) + "/n=" + to_string(n);
+        if (!wanted(name)) return;
+
+        BenchResult result = {name, n, homework, runBenchmark(bench, setup, work)};
+        cout << left << setw(44) << name << right
+             << setw(12) << formatNs(result.stats.medianNs)
+             << "  (MAD " << formatNs(result.stats.madNs)
+             << ", p95 " << formatNs(result.stats.p95Ns) << ")\n";
+        results.push_back(result);
+    }
+
+    template <typename Work>
+    void run(const string& base, size_t n, size_t homework, Work work)
+    {
+        run(base, n, homework, NoBenchmarkSetup(), work);
+    }
+
+    const vector<BenchResult>& getResults() const { return results; }
+};
+
+// One result per line so --baseline can read it back line by line
+void writeResultsJson(const string& filename, const BenchOptions& options,
+                      const vector<BenchResult>& results)
+{
+    ofstream out(filename.c_str());
+    if (!out) throw runtime_error("cannot write " + filename);
+
+    out << "{\n  \"seed\": " << options.seed
+        << ",\n  \"warmup\": " << options.warmup
+        << ",\n  \"reps\": " << options.reps
+        << ",\n  \"results\": [";
+    out << fixed << setprecision(1);
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const BenchResult& r = results[i];
+        out << (i == 0 ? "\n" : ",\n")
+            << "    {\"name\": \"" << r.name << "\", \"n\": " << r.n
+            << ", \"homework\": " << r.homework
+            << ", \"min_ns\": " << r.stats.minNs
+            << ", \"median_ns\": " << r.stats.medianNs
+            << ", \"mad_ns\": " << r.stats.madNs
+            << ", \"p95_ns\": " << r.stats.p95Ns << "}";
+    }
+    out << (results.empty() ? "]\n}\n" : "\n  ]\n}\n");
+    if (!out) throw runtime_error("error writing " + filename);
+}
+
+struct BaselineEntry
+{
+    double medianNs;
+    double madNs;
+};
+
+// name -> median and MAD from a file written by writeResultsJson
+// (files without mad_ns read as MAD 0)
+map<string, BaselineEntry> readBaseline(const string& filename)
+{
+    ifstream in(filename.c_str());
+    if (!in) throw runtime_error("cannot open baseline " + filename);
+
+    map<string, BaselineEntry> entries;
+    const string nameKey = "\"name\": \"";
+    const string medianKey = "\"median_ns\": ";
+    const string madKey = "\"mad_ns\": ";
+    string line;
+    while (getline(in, line))
+    {
+        size_t name = line.find(nameKey);
+        size_t median = line.find(medianKey);
+        if (name == string::npos || median == string::npos) continue;
+
+        name += nameKey.size();
+        size_t nameEnd = line.find('"', name);
+        if (nameEnd == string::npos) continue;
+
+        size_t mad = line.find(madKey);
+        BaselineEntry entry;
+        entry.medianNs = strtod(line.c_str() + median + medianKey.size(), NULL);
+        entry.madNs = mad == string::npos ? 0.0 : strtod(line.c_str() + mad + madKey.size(), NULL);
+        entries[line.substr(name, nameEnd - name)] = entry;
+    }
+    if (entries.empty()) throw runtime_error("no results in baseline " + filename);
+    return entries;
+}
+
+// Prints the comparison; returns the number of regressions
+// over options.maxRegression (0 when it is not set). A slowdown
+// only counts if it is also larger than the baseline MAD plus
+// the current MAD, so trial-to-trial noise does not fail a run.
+size_t compareWithBaseline(const BenchOptions& options, const vector<BenchResult>& results)
+{
+    map<string, BaselineEntry> baseline = readBaseline(options.baselineFile);
+
+    cout << "\n=== Compared with " << options.baselineFile << " (median) ===\n";
+    size_t regressions = 0;
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const BenchResult& r = results[i];
+        map<string, BaselineEntry>::const_iterator base = baseline.find(r.name);
+        if (base == baseline.end() || base->second.medianNs <= 0.0)
+        {
+            cout << left << setw(44) << r.name << right << setw(12) << "-"
+                 << setw(12) << formatNs(r.stats.medianNs) << "  (not in baseline)\n";
+            continue;
+        }
+
+        double baseNs = base->second.medianNs;
+        double change = (r.stats.medianNs / baseNs - 1.0) * 100.0;
+        double noiseNs = base->second.madNs + r.stats.madNs;
+        bool overThreshold = options.maxRegression >= 0 && change > options.maxRegression;
+        bool regressed = overThreshold && r.stats.medianNs - baseNs > noiseNs;
+        if (regressed) ++regressions;
+
+        ostringstream percent;
+        percent << showpos << fixed << setprecision(1) << change << "%";
+        cout << left << setw(44) << r.name << right
+             << setw(12) << formatNs(baseNs)
+             << setw(12) << formatNs(r.stats.medianNs)
+             << "  " << percent.str()
+             << (regressed ? "  REGRESSION" : overThreshold ? "  (within noise)" : "") << "\n";
+    }
+    return regressions;
+}
+
+// -----------------------------------------------
+// Input data: "homework" scores per student, graded
+// -----------------------------------------------
+vector<Person> makeStudents(size_t n, size_t homework, const StudentGenerator& generator)
+{
+    vector<Person> students(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        Person& p = students[i];
+        p.setFirstName("Name" + to_string(i + 1));
+        p.setSurname("Surname" + to_string(i + 1));
+
+        StudentGenerator::Stream random = generator.stream(i);
+        p.reserveHomeworkScores(homework);
+        for (size_t k = 0; k < homework; ++k) p.addHomeworkScore(random.nextScore());
+        p.setExamScore(random.nextScore());
+        p.calculateFinalGrades();
+    }
+    return students;
+}
+
+// -----------------------------------------------
+// Benchmarks
+// -----------------------------------------------
+void benchPerson(BenchRunner& runner, size_t n, size_t homework,
+                 const StudentGenerator& generator)
+{
+    vector<Person> students = makeStudents(n, homework, generator);
+
+    runner.run("calculateFinalGradeAverage", n, homework, [&]() {
+        for (size_t i = 0; i < students.size(); ++i) students[i].calculateFinalGradeAverage();
+        doNotOptimize(students);
+    });
+
+    runner.run("calculateFinalGradeMedian", n, homework, [&]() {
+        for (size_t i = 0; i < students.size(); ++i) students[i].calculateFinalGradeMedian();
+        doNotOptimize(students);
+    });
+
+    // Neighbours share the "Surname" prefix, like a sorted run
+    runner.run("operator<", n, homework, [&]() {
+        size_t less = 0;
+        for (size_t i = 1; i < students.size(); ++i) less += students[i - 1] < students[i] ? 1 : 0;
+        doNotOptimize(less);
+    });
+
+    ostringstream out;
+    runner.run("operator<<", n, homework,
+        [&]() { out.str(""); out.clear(); },
+        [&]() {
+            for (size_t i = 0; i < students.size(); ++i) out << students[i];
+            doNotOptimize(out);
+        });
+}
+
+void benchGenerator(BenchRunner& runner, size_t n, const StudentGenerator& generator)
+{
+    // fillRandomScores always draws kHomeworkCount scores
+    vector<Person> people;
+    runner.run("fillRandomScores", n, StudentGenerator::kHomeworkCount,
+        [&]() { people.assign(n, Person()); },
+        [&]() {
+            for (size_t i = 0; i < n; ++i) fillRandomScores(people[i], i, generator);
+            doNotOptimize(people);
+        });
+}
+
+template <typename Container>
+void benchStrategies(BenchRunner& runner, const string& containerName,
+                     const vector<Person>& source, size_t homework)
+{
+    const Container students(source.begin(), source.end());
+    size_t n = students.size();
+    Container passed, failed, base;
+
+    runner.run("strategy1/" + containerName, n, homework,
+        [&]() { passed = Container(); failed = Container(); },
+        [&]() { strategy1_splitCopy(students, passed, failed); });
+
+    runner.run("strategy2/" + containerName, n, homework,
+        [&]() { base = students; failed = Container(); },
+        [&]() { strategy2_moveFailed(base, failed); });
+
+    runner.run("strategy3/" + containerName, n, homework,
+        [&]() { passed = Container(); failed = Container(); },
+        [&]() { strategy3_splitOnePass(students, passed, failed); });
+}
+
+int main(int argc, char* argv[])
+{
+    BenchOptions options;
+    try
+    {
+        options = parseOptions(argc, argv);
+    }
+    catch (const std::exception& ex)
+    {
+        cerr << "ERROR: " << ex.what() << "\n\n";
+        printUsage(cerr, argv[0]);
+        return 2;
+    }
+
+    try
+    {
+        StudentGenerator generator(options.seed);
+        BenchRunner runner(options);
+        cout << "seed " << options.seed << ", " << options.warmup << " warm-up + "
+             << options.reps << " trials, median shown\n\n";
+
+        for (size_t s = 0; s < options.sizes.size(); ++s)
+        {
+            size_t n = options.sizes[s];
+            benchGenerator(runner, n, generator);
+
+            for (size_t h = 0; h < options.homeworkCounts.size(); ++h)
+            {
+                size_t homework = options.homeworkCounts[h];
+                benchPerson(runner, n, homework, generator);
+
+                vector<Person> source = makeStudents(n, homework, generator);
+                benchStrategies<std::vector<Person> >(runner, "vector", source, homework);
+                benchStrategies<std::list<Person> >(runner, "list", source, homework);
+                benchStrategies<std::deque<Person> >(runner, "deque", source, homework);
+            }
+        }
+
+        if (!options.outputFile.empty())
+        {
+            writeResultsJson(options.outputFile, options, runner.getResults());
+            cout << "\nResults written to " << options.outputFile << "\n";
+        }
+
+        if (!options.baselineFile.empty())
+        {
+            size_t regressions = compareWithBaseline(options, runner.getResults());
+            if (regressions > 0)
+            {
+                cout << "\n" << regressions << " benchmark(s) regressed by more than "
+                     << options.maxRegression << "%\n";
+                return 1;
+            }
+        }
+    }
+    catch (const std::exception& ex)
+    {
+        cerr << "ERROR: " << ex.what() << "\n";
+        return 2;
+    }
+
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <fstream>
 #include <vector>
 #include <list>
 #include <deque>
@@ -8,8 +9,33 @@
 #include <string>
 #include <limits>
 #include <type_traits>
+#include <iomanip>
+#include <sstream>
+#include <iterator>
+#include <stdexcept>
+#include <cstdio>
+#include <cstring>
+#include <thread>
 
 #include "Person.h"
+#include "StudentFile.h"
+#include "StudentTable.h"
+#include "GradeKernels.h"
+#include "MemoryStats.h"
+#include "Arena.h"
+#include "ArenaStudent.h"
+#include "Parallel.h"
+#include "StudentGenerator.h"
+#include "Pipeline.h"
+#include "StudentSnapshot.h"
+#include "StudentSort.h"
+#include "StudentPartition.h"
+#include "SplitStrategies.h"
+#include "StudentView.h"
+#include "Collation.h"
+#include "CommandLine.h"
+#include "Benchmark.h"
+#include "PerfCounters.h"
 
 using namespace std;
 
@@ -30,118 +56,185 @@ void setupConsole()
 }
 
 // -----------------------------------------------
-// Random score generator used for all containers
+// Helper: reserve capacity only for std::vector<Person>
 // -----------------------------------------------
-void fillRandomScores(Person& p, int index)
+template <typename Container>
+void maybeReserve(Container&, size_t)
 {
-    static random_device rd;
-    static mt19937 gen(rd());
-    static uniform_int_distribution<int> dist(1, 10);
-
-    // Example names: Name1 Surname1, Name2 Surname2, ...
-    p.setFirstName("Name" + to_string(index + 1));
-    p.setSurname("Surname" + to_string(index + 1));
-
-    vector<int> hw(15);
-    for (int& x : hw) x = dist(gen);
-
-    p.setHomeworkScores(hw);
-    p.setExamScore(dist(gen));
+    // default: do nothing
+}
 
-    // For this project we use the average formula
-    p.calculateFinalGradeAverage();
+template <typename Alloc>
+void maybeReserve(std::vector<Person, Alloc>& c, size_t count)
+{
+    c.reserve(count);
 }
 
 // -----------------------------------------------
-// Predicates for passed / failed
+// Fill helpers for generateStudents
+//   vector: resize once, threads fill disjoint slices in place
+//   others: each thread builds its slice in a private vector,
+//           slices are moved into the container in index order
 // -----------------------------------------------
-inline bool isPassed(const Person& p)
+template <typename Alloc>
+void appendGenerated(std::vector<Person, Alloc>& students, size_t count,
+                     const StudentGenerator& generator, unsigned threads)
 {
-    return p.getFinalGrade() >= 5.0;
-}
+    size_t offset = students.size();
+    students.resize(offset + count);
 
-inline bool isFailed(const Person& p)
-{
-    return !isPassed(p);
+    parallelFor(count, threads, [&](size_t begin, size_t end, unsigned) {
+        for (size_t i = begin; i < end; ++i)
+            fillRandomScores(students[offset + i], i, generator);
+    });
 }
 
-// -----------------------------------------------
-// Helper: reserve capacity only for std::vector<Person>
-// -----------------------------------------------
 template <typename Container>
-void maybeReserve(Container&, size_t)
+void appendGenerated(Container& students, size_t count,
+                     const StudentGenerator& generator, unsigned threads)
 {
-    // default: do nothing
-}
+    if (threads <= 1)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            Person p;
+            fillRandomScores(p, i, generator);
+            students.push_back(std::move(p));
+        }
+        return;
+    }
 
-template <>
-void maybeReserve<std::vector<Person>>(std::vector<Person>& c, size_t count)
-{
-    c.reserve(count);
+    vector<vector<Person> > slices(threads);
+    parallelFor(count, threads, [&](size_t begin, size_t end, unsigned part) {
+        slices[part].reserve(end - begin);
+        for (size_t i = begin; i < end; ++i)
+        {
+            slices[part].push_back(Person());
+            fillRandomScores(slices[part].back(), i, generator);
+        }
+    });
+
+    for (unsigned part = 0; part < threads; ++part)
+    {
+        for (size_t i = 0; i < slices[part].size(); ++i)
+            students.push_back(std::move(slices[part][i]));
+        vector<Person>().swap(slices[part]);
+    }
 }
 
 // -----------------------------------------------
 // Generate N students into any container type
 // Uses std::vector, std::list or std::deque
+// The data depends only on the generator's seed, never on
+// the number of threads.
 // -----------------------------------------------
 template <typename Container>
-Container generateStudents(size_t count)
+Container generateStudents(size_t count, const StudentGenerator& generator,
+                           unsigned threads = 1)
 {
     Container students;
     maybeReserve(students, count); // only does something for vector<Person>
+    appendGenerated(students, count, generator, threads);
+
+    return students;
+}
+
+// -----------------------------------------------
+// StudentTable: same names and score distribution,
+// written straight into the columns
+// -----------------------------------------------
+template <>
+StudentTable generateStudents<StudentTable>(size_t count,
+                                            const StudentGenerator& generator,
+                                            unsigned threads)
+{
+    const size_t hwCount = StudentGenerator::kHomeworkCount;
+
+    vector<StudentTable> slices(threads < 1 ? 1 : threads, StudentTable(hwCount));
+    parallelFor(count, threads, [&](size_t begin, size_t end, unsigned part) {
+        StudentTable& slice = slices[part];
+        slice.reserve(end - begin);
 
-    for (size_t i = 0; i < count; ++i)
+        uint8_t hw[hwCount];
+        for (size_t i = begin; i < end; ++i)
+        {
+            string first = "Name" + to_string(i + 1);
+            string last  = "Surname" + to_string(i + 1);
+
+            StudentGenerator::Stream random = generator.stream(i);
+            for (uint8_t& x : hw) x = static_cast<uint8_t>(random.nextScore());
+
+            slice.addStudent(first.data(), first.size(), last.data(), last.size(),
+                             hw, static_cast<uint8_t>(random.nextScore()));
+        }
+    });
+
+    StudentTable students(hwCount);
+    if (slices.size() == 1)
+    {
+        students.swap(slices[0]);
+    }
+    else
     {
-        Person p;
-        fillRandomScores(p, static_cast<int>(i));
-        students.push_back(std::move(p));
+        students.reserve(count);
+        for (size_t part = 0; part < slices.size(); ++part) students.append(slices[part]);
     }
 
+    // For this project we use the average formula
+    students.calculateFinalGradesAverage();
+
     return students;
 }
 
 // -----------------------------------------------
-// Strategy 1: copy students to TWO new containers
-//   - original students container is NOT changed
-//   - passed + failed are created using std::copy_if
+// View split: passed + failed as views over the base
+//   - nothing is copied or moved, one pointer per student
+//     (StudentView in StudentView.h)
+//   - the views are valid while "students" is unchanged
 // -----------------------------------------------
 template <typename Container>
-void strategy1_splitCopy(const Container& students,
-                         Container& passed,
-                         Container& failed)
+struct SplitView
+{
+    typedef StudentView<typename Container::value_type> type;
+};
+
+template <typename Container>
+void strategyView_split(const Container& students,
+                        typename SplitView<Container>::type& passed,
+                        typename SplitView<Container>::type& failed)
 {
     passed.clear();
     failed.clear();
+    splitView(students, passed, failed, isPassed);
+}
 
-    std::copy_if(students.begin(), students.end(),
-                 std::back_inserter(passed), isPassed);
-
-    std::copy_if(students.begin(), students.end(),
-                 std::back_inserter(failed), isFailed);
+template <typename T>
+size_t viewBytes(const StudentView<T>& view)
+{
+    return view.memoryBytes();
 }
 
 // -----------------------------------------------
-// Strategy 2: move failed students OUT of base
-//   - after this, "students" contains only PASSED
-//   - "failed" contains FAILED students
-//   - uses std::stable_partition to split
+// StudentTable rows are already addressed by number,
+// so its view holds row indices (StudentTableView)
 // -----------------------------------------------
-template <typename Container>
-void strategy2_moveFailed(Container& students,
-                          Container& failed)
+template <>
+struct SplitView<StudentTable>
 {
-    failed.clear();
+    typedef StudentTableView type;
+};
 
-    // Partition: [passed | failed]
-    typename Container::iterator partitionPoint =
-        std::stable_partition(students.begin(), students.end(), isPassed);
-
-    // Move failed students into separate container
-    std::move(partitionPoint, students.end(),
-              std::back_inserter(failed));
+template <>
+void strategyView_split<StudentTable>(const StudentTable& students,
+                                      StudentTableView& passed,
+                                      StudentTableView& failed)
+{
+    splitView(students, passed, failed, kPassThreshold);
+}
 
-    // Shrink base container so it holds only passed students
-    students.erase(partitionPoint, students.end());
+size_t viewBytes(const StudentTableView& view)
+{
+    return view.memoryBytes();
 }
 
 // -----------------------------------------------
@@ -156,98 +249,1696 @@ long long measureMs(Func&& f)
     return chrono::duration_cast<ms>(end - start).count();
 }
 
+// -----------------------------------------------
+// Utility: same as measureMs, but in (fractional) seconds
+// -----------------------------------------------
+template <typename Func>
+double measureSeconds(Func&& f)
+{
+    Clock::time_point start = Clock::now();
+    f();
+    Clock::time_point end   = Clock::now();
+    return chrono::duration<double>(end - start).count();
+}
+
+// -----------------------------------------------
+// Stage profile: one untimed run of "work" (after "setup")
+// with its heap use (MemoryStats.h) and the perf counters
+// (invalid when the counters are unavailable)
+//   peakHeapBytes – live heap high-water mark above the start
+//   peakRssKb     – VmHWM above the start (process-wide peak
+//                   if the kernel cannot reset it: rssExact)
+// -----------------------------------------------
+struct StageProfile
+{
+    unsigned long long allocations;
+    unsigned long long bytes;
+    long long peakHeapBytes;
+    long peakRssKb;
+    bool rssExact;
+    PerfSample perf;
+};
+
+template <typename Setup, typename Work>
+StageProfile profileStage(PerfCounters& counters, Setup setup, Work work)
+{
+    setup();
+    StageProfile profile;
+    profile.rssExact = resetPeakRss();
+    long rssBase = currentRssKb();
+    resetPeakHeap();
+    long long heapBase = liveHeapBytes();
+    unsigned long long allocStart = allocationCount();
+    unsigned long long bytesStart = bytesAllocated();
+
+    counters.start();
+    work();
+    counters.stop();
+
+    profile.allocations = allocationCount() - allocStart;
+    profile.bytes = bytesAllocated() - bytesStart;
+    profile.peakHeapBytes = peakHeapBytes() - heapBase;
+    profile.peakRssKb = peakRssKb() - (profile.rssExact ? rssBase : 0);
+    profile.perf = counters.read();
+    return profile;
+}
+
+string formatBytes(double bytes)
+{
+    ostringstream out;
+    out << fixed << setprecision(1);
+    if (bytes >= 1024.0 * 1024.0) out << bytes / (1024.0 * 1024.0) << " MB";
+    else                          out << bytes / 1024.0 << " KB";
+    return out.str();
+}
+
+void printMemoryHeader()
+{
+    cout << left << setw(12) << "Memory" << right << setw(12) << "allocs/stud"
+         << setw(12) << "allocated" << setw(12) << "peak heap" << setw(12) << "peak RSS" << "\n";
+}
+
+void printMemoryRow(const string& label, const StageProfile& profile, size_t n)
+{
+    ostringstream perStudent;
+    perStudent << fixed << setprecision(2) << double(profile.allocations) / n;
+
+    cout << left << setw(12) << label << right << setw(12) << perStudent.str()
+         << setw(12) << formatBytes(double(profile.bytes))
+         << setw(12) << formatBytes(double(profile.peakHeapBytes))
+         << setw(12) << formatBytes(profile.peakRssKb * 1024.0) << "\n";
+}
+
+// 1234567 -> "1.23M"; invalid counters print "-"
+string formatCount(const PerfSample& sample, PerfEvent event)
+{
+    if (!sample.has(event)) return "-";
+
+    double value = double(sample.value[event]);
+    const char* suffix = "";
+    if (value >= 1e9)      { value /= 1e9; suffix = "G"; }
+    else if (value >= 1e6) { value /= 1e6; suffix = "M"; }
+    else if (value >= 1e3) { value /= 1e3; suffix = "K"; }
+
+    ostringstream out;
+    out << fixed << setprecision(suffix[0] != '\0' ? 2 : 0) << value << suffix;
+    return out.str();
+}
+
+void printCounterHeader()
+{
+    cout << left << setw(12) << "Counters" << right
+         << setw(10) << "cycles" << setw(10) << "instr" << setw(6) << "IPC"
+         << setw(12) << "cache-miss" << setw(13) << "branch-miss"
+         << setw(13) << "page-faults" << "\n";
+}
+
+void printCounterRow(const string& label, const PerfSample& sample)
+{
+    string ipc = "-";
+    if (sample.has(PerfCycles) && sample.has(PerfInstructions) && sample.value[PerfCycles] > 0)
+    {
+        ostringstream out;
+        out << fixed << setprecision(2)
+            << double(sample.value[PerfInstructions]) / sample.value[PerfCycles];
+        ipc = out.str();
+    }
+
+    cout << left << setw(12) << label << right
+         << setw(10) << formatCount(sample, PerfCycles)
+         << setw(10) << formatCount(sample, PerfInstructions)
+         << setw(6) << ipc
+         << setw(12) << formatCount(sample, PerfCacheMisses)
+         << setw(13) << formatCount(sample, PerfBranchMisses)
+         << setw(13) << formatCount(sample, PerfPageFaults) << "\n";
+}
+
+// One harness result: median, then the spread
+void printTimingRow(const string& label, const BenchmarkStats& stats, const string& note)
+{
+    cout << left << setw(12) << label << right << fixed << setprecision(3)
+         << setw(9) << stats.medianMs() << " ms  (min " << stats.minMs()
+         << ", MAD " << stats.madMs() << ", p95 " << stats.p95Ms() << ")  "
+         << note << "\n";
+    cout.unsetf(ios::floatfield);
+}
+
 // -----------------------------------------------
 // Run tests for ONE container type (vector/list/deque)
+//   every stage goes through the benchmark harness
+//   (Benchmark.h): warm-up, then median of "trials"
 // -----------------------------------------------
 template <typename Container>
-void runTestsForContainer(const string& containerName)
+void runTestsForContainer(const string& containerName,
+                          const StudentGenerator& generator,
+                          const BenchmarkOptions& bench = BenchmarkOptions())
 {
     cout << "\n======================================\n";
-    cout << "  " << containerName << " (Strategy 1 vs Strategy 2)\n";
+    cout << "  " << containerName << " (Strategy 1 vs 2 vs 3 vs views)\n";
+    cout << "  seed " << generator.getSeed() << ", " << bench.warmup << " warm-up + "
+         << bench.trials << " trials per stage\n";
     cout << "======================================\n";
 
+    // Counted in a separate untimed run per stage
+    PerfCounters counters;
+    if (!counters.available())
+        cout << "(perf counters unavailable: " << counters.unavailableReason() << ")\n";
+    else if (!counters.unavailableReason().empty())
+        cout << "(some perf counters unavailable, shown as -: " << counters.unavailableReason() << ")\n";
+
     const size_t sizesArray[] = {1000, 10000, 100000};
     const size_t numSizes = sizeof(sizesArray) / sizeof(sizesArray[0]);
+    typedef typename SplitView<Container>::type View;
 
     for (size_t idx = 0; idx < numSizes; ++idx)
     {
         size_t n = sizesArray[idx];
         Container students;
 
-        // 1) Generate students
-        long long genTime = measureMs([&]() {
-            students = generateStudents<Container>(n);
-        });
+        // 1) Generate students (the last trial's data is kept)
+        auto resetStudents = [&]() { students = Container(); };
+        auto generate = [&]() { students = generateStudents<Container>(n, generator); };
+        StageProfile genProfile = profileStage(counters, resetStudents, generate);
+        BenchmarkStats genStats = runBenchmark(bench, resetStudents, generate);
 
         // 2) Strategy 1: copy to passed + failed
         Container passed1, failed1;
-        long long strategy1Time = measureMs([&]() {
-            strategy1_splitCopy(students, passed1, failed1);
-        });
+        auto reset1 = [&]() { passed1 = Container(); failed1 = Container(); };
+        auto split1 = [&]() { strategy1_splitCopy(students, passed1, failed1); };
+        StageProfile strategy1Profile = profileStage(counters, reset1, split1);
+        BenchmarkStats strategy1Stats = runBenchmark(bench, reset1, split1);
 
-        // 3) Strategy 2: move failed out of base container
-        Container students2 = students;   // fresh copy
-        Container failed2;
-        long long strategy2Time = measureMs([&]() {
-            strategy2_moveFailed(students2, failed2);
-        });
+        // 3) Strategy 2: move failed out of a fresh copy of the base
+        Container students2, failed2;
+        auto reset2 = [&]() { students2 = students; failed2 = Container(); };
+        auto split2 = [&]() { strategy2_moveFailed(students2, failed2); };
+        StageProfile strategy2Profile = profileStage(counters, reset2, split2);
+        BenchmarkStats strategy2Stats = runBenchmark(bench, reset2, split2);
+
+        // 4) Strategy 3: one pass -> passed + failed
+        Container passed3, failed3;
+        auto reset3 = [&]() { passed3 = Container(); failed3 = Container(); };
+        auto split3 = [&]() { strategy3_splitOnePass(students, passed3, failed3); };
+        StageProfile strategy3Profile = profileStage(counters, reset3, split3);
+        BenchmarkStats strategy3Stats = runBenchmark(bench, reset3, split3);
 
-        // 4) Print results
+        // 5) Views: passed + failed refer to the base container
+        View passedView, failedView;
+        auto resetViews = [&]() { passedView = View(); failedView = View(); };
+        auto splitViews = [&]() {
+            strategyView_split(students, passedView, failedView);
+            doNotOptimize(passedView);
+            doNotOptimize(failedView);
+        };
+        StageProfile viewProfile = profileStage(counters, resetViews, splitViews);
+        BenchmarkStats viewStats = runBenchmark(bench, resetViews, splitViews);
+        size_t viewKb = (viewBytes(passedView) + viewBytes(failedView)) / 1024;
+
+        // 6) Print results
         cout << "\n--- N = " << n << " students ---\n";
-        cout << "Generate:    " << genTime       << " ms\n";
-        cout << "Strategy 1:  " << strategy1Time << " ms  (copy -> passed + failed)\n";
-        cout << "Strategy 2:  " << strategy2Time << " ms  (move failed, shrink base)\n";
+        printTimingRow("Generate:", genStats, "");
+        printTimingRow("Strategy 1:", strategy1Stats, "(copy -> passed + failed)");
+        printTimingRow("Strategy 2:", strategy2Stats, "(move failed, shrink base)");
+        printTimingRow("Strategy 3:", strategy3Stats, "(one pass -> passed + failed)");
+        printTimingRow("Views:", viewStats, "(no copies, " + to_string(viewKb) + " KB of views)");
+
+        if (counters.available())
+        {
+            printCounterHeader();
+            printCounterRow("Generate:", genProfile.perf);
+            printCounterRow("Strategy 1:", strategy1Profile.perf);
+            printCounterRow("Strategy 2:", strategy2Profile.perf);
+            printCounterRow("Strategy 3:", strategy3Profile.perf);
+            printCounterRow("Views:", viewProfile.perf);
+        }
 
         cout << "Sizes (Strategy 1): passed = " << passed1.size()
              << ", failed = " << failed1.size() << "\n";
         cout << "Sizes (Strategy 2): passed = " << students2.size()
              << ", failed = " << failed2.size() << "\n";
+        cout << "Sizes (Strategy 3): passed = " << passed3.size()
+             << ", failed = " << failed3.size() << "\n";
+        cout << "Sizes (Views):      passed = " << passedView.size()
+             << ", failed = " << failedView.size() << "\n";
+
+        printMemoryHeader();
+        printMemoryRow("Generate:", genProfile, n);
+        printMemoryRow("Strategy 1:", strategy1Profile, n);
+        printMemoryRow("Strategy 2:", strategy2Profile, n);
+        printMemoryRow("Strategy 3:", strategy3Profile, n);
+        printMemoryRow("Views:", viewProfile, n);
+        if (!genProfile.rssExact)
+            cout << "(peak RSS is the process-wide peak: the kernel does not allow resetting it)\n";
     }
 }
 
 // -----------------------------------------------
-// Main menu for v1.0
+// Thread counts for scaling tables: 1, 2, 4, ..., maxThreads
 // -----------------------------------------------
-int main()
+vector<unsigned> threadCounts(unsigned maxThreads)
 {
-    setupConsole();
+    vector<unsigned> counts;
+    for (unsigned t = 1; t < maxThreads; t *= 2)
+    {
+        counts.push_back(t);
+    }
+    counts.push_back(maxThreads < 1 ? 1 : maxThreads);
+    return counts;
+}
 
-    cout << "=== STUDENT GRADING SYSTEM - v1.0 ===\n\n";
-    cout << "This version compares two splitting strategies\n";
-    cout << "for three containers: std::vector, std::list, std::deque.\n\n";
-    cout << "1. Test std::vector\n";
-    cout << "2. Test std::list\n";
-    cout << "3. Test std::deque\n";
-    cout << "4. Test ALL containers\n";
-    cout << "Choice: ";
-    cout.flush();   // make sure the prompt appears
+// -----------------------------------------------
+// Build a bigger students file by repeating the data rows
+// of "source" (header is written once)
+// -----------------------------------------------
+void writeScaledFile(const string& source, const string& target, size_t copies)
+{
+    ifstream in(source.c_str(), ios::binary);
+    if (!in.is_open())
+    {
+        throw runtime_error("Could not open file: " + source);
+    }
 
-    int choice = 0;
-    if (!(cin >> choice))
+    string header;
+    getline(in, header);
+    string body((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+    if (!body.empty() && body[body.size() - 1] != '\n') body += '\n';
+
+    ofstream out(target.c_str(), ios::binary);
+    if (!out.is_open())
     {
-        cerr << "Invalid input. Exiting.\n";
-        return 0;
+        throw runtime_error("Could not open file for writing: " + target);
     }
 
-    try
+    out << header << '\n';
+    for (size_t i = 0; i < copies; ++i)
     {
-        if (choice == 1)
+        out.write(body.data(), static_cast<streamsize>(body.size()));
+    }
+}
+
+// -----------------------------------------------
+// FNV-1a checksum over names and scores, used to show that
+// datasets generated with different thread counts are equal
+// -----------------------------------------------
+inline void fnvMix(unsigned long long& hash, const void* data, size_t size)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+}
+
+template <typename Container>
+unsigned long long datasetChecksum(const Container& students)
+{
+    unsigned long long hash = 14695981039346656037ULL;
+    for (typename Container::const_iterator it = students.begin(); it != students.end(); ++it)
+    {
+        fnvMix(hash, it->getFirstName().data(), it->getFirstName().size());
+        fnvMix(hash, it->getSurname().data(), it->getSurname().size());
+        for (size_t k = 0; k < it->getHomeworkScores().size(); ++k)
+            fnvMix(hash, &it->getHomeworkScores()[k], sizeof(int));
+        int exam = it->getExamScore();
+        fnvMix(hash, &exam, sizeof(exam));
+    }
+    return hash;
+}
+
+template <>
+unsigned long long datasetChecksum<StudentTable>(const StudentTable& students)
+{
+    unsigned long long hash = 14695981039346656037ULL;
+    for (size_t row = 0; row < students.size(); ++row)
+    {
+        fnvMix(hash, students.firstNameData(row), students.firstNameLength(row));
+        fnvMix(hash, students.surnameData(row), students.surnameLength(row));
+        for (size_t k = 0; k < students.homeworkCount(); ++k)
         {
-            runTestsForContainer<std::vector<Person> >("std::vector<Person>");
+            int score = students.homeworkRow(row)[k];
+            fnvMix(hash, &score, sizeof(int));
         }
-        else if (choice == 2)
+        int exam = students.examScore(row);
+        fnvMix(hash, &exam, sizeof(exam));
+    }
+    return hash;
+}
+
+// -----------------------------------------------
+// Check that two loaders produced the same students
+// -----------------------------------------------
+bool sameStudents(const vector<Person>& a, const vector<Person>& b)
+{
+    if (a.size() != b.size()) return false;
+
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        if (a[i].getFirstName()      != b[i].getFirstName() ||
+            a[i].getSurname()        != b[i].getSurname() ||
+            a[i].getExamScore()      != b[i].getExamScore() ||
+            a[i].getHomeworkScores() != b[i].getHomeworkScores())
         {
-            runTestsForContainer<std::list<Person> >("std::list<Person>");
+            return false;
         }
-        else if (choice == 3)
+    }
+    return true;
+}
+
+// -----------------------------------------------
+// One line of the loader benchmark: time, MB/s, rows/s
+// -----------------------------------------------
+void printLoadRow(const string& label, double seconds,
+                  double megabytes, double rows)
+{
+    cout << left << setw(10) << label << right << fixed
+         << setprecision(1) << setw(9) << seconds * 1000.0 << " ms  "
+         << setw(8) << megabytes / seconds << " MB/s  "
+         << setprecision(0) << setw(11) << rows / seconds << " rows/s\n";
+}
+
+// -----------------------------------------------
+// Loader benchmark: readFromFile vs readFromFileMapped
+//   maxThreads = upper bound for the parallel mmap scaling rows
+//
+// Every load is checked by checksum and freed before the next
+// one, so only one copy of the file is in memory at a time.
+// The last (maxThreads) load then goes through the usual
+// Sort / Split / Write stages, printed under the load rows.
+// -----------------------------------------------
+void runLoaderBenchmark(const string& source, unsigned maxThreads)
+{
+    cout << "\n======================================\n";
+    cout << "  File loading (getline vs memory-mapped)\n";
+    cout << "  and the Sort / Split / Write stages after it\n";
+    cout << "======================================\n";
+
+    // x1000 of students10000.txt is the 10M-row file
+    const size_t scalesArray[] = {1, 10, 100, 1000};
+    const size_t numScales = sizeof(scalesArray) / sizeof(scalesArray[0]);
+
+    for (size_t idx = 0; idx < numScales; ++idx)
+    {
+        size_t copies = scalesArray[idx];
+        string scaled = "students_scaled_x" + to_string(copies) + ".txt";
+        writeScaledFile(source, scaled, copies);
+
+        double megabytes = 0.0;
         {
-            runTestsForContainer<std::deque<Person> >("std::deque<Person>");
+            MappedFile probe(scaled);
+            megabytes = probe.size() / (1024.0 * 1024.0);
         }
-        else if (choice == 4)
+
+        vector<Person> students;
+        double classicSec = measureSeconds([&]() {
+            students = readFromFile(scaled);
+        });
+        size_t rowCount = students.size();
+        unsigned long long reference = datasetChecksum(students);
+        vector<Person>().swap(students);
+
+        double mappedSec = measureSeconds([&]() {
+            students = readFromFileMapped(scaled);
+        });
+        bool identical = students.size() == rowCount && datasetChecksum(students) == reference;
+        vector<Person>().swap(students);
+
+        double rows = static_cast<double>(rowCount);
+        cout << "\n--- " << scaled << " (" << rowCount << " rows, "
+             << fixed << setprecision(1) << megabytes << " MB) ---\n";
+        printLoadRow("getline:", classicSec, megabytes, rows);
+        printLoadRow("mmap:",    mappedSec,  megabytes, rows);
+        cout << "Speedup:  " << setprecision(2) << classicSec / mappedSec
+             << "x, results " << (identical ? "identical" : "DIFFER") << "\n";
+
+        // Parallel scaling: 1, 2, 4, ... threads (plus maxThreads itself);
+        // the last load is kept for the stages below
+        vector<unsigned> counts = threadCounts(maxThreads);
+        for (size_t c = 0; c < counts.size(); ++c)
+        {
+            unsigned t = counts[c];
+            vector<Person>().swap(students);
+            double parallelSec = measureSeconds([&]() {
+                students = readFromFileMapped(scaled, t);
+            });
+            bool same = students.size() == rowCount && datasetChecksum(students) == reference;
+
+            string label = "mmap x" + to_string(t) + ":";
+            printLoadRow(label, parallelSec, megabytes, rows);
+            cout << "          speedup vs 1 thread " << setprecision(2)
+                 << mappedSec / parallelSec << "x, results "
+                 << (same ? "identical" : "DIFFER") << "\n";
+        }
+        remove(scaled.c_str());
+
+        // Stages on the loaded data (Strategy 2 keeps a single copy).
+        // The loaders do not grade, so Grade comes first.
+        vector<Person> failed;
+        double gradeSec = measureSeconds([&]() {
+            for (size_t i = 0; i < students.size(); ++i) students[i].calculateFinalGrades();
+        });
+        double sortSec = measureSeconds([&]() {
+            sortStudents(students, maxThreads);
+        });
+        double splitSec = measureSeconds([&]() {
+            strategy2_moveFailed(students, failed);
+        });
+        string passedFile = "loaded_passed_x" + to_string(copies) + ".txt";
+        string failedFile = "loaded_failed_x" + to_string(copies) + ".txt";
+        double writeSec = measureSeconds([&]() {
+            writeStudentsToFile(students, passedFile);
+            writeStudentsToFile(failed, failedFile);
+        });
+        remove(passedFile.c_str());
+        remove(failedFile.c_str());
+
+        printLoadRow("Grade:", gradeSec, megabytes, rows);
+        printLoadRow("Sort:",  sortSec,  megabytes, rows);
+        printLoadRow("Split:", splitSec, megabytes, rows);
+        printLoadRow("Write:", writeSec, megabytes, rows);
+        cout << "Sizes (Strategy 2): passed = " << students.size()
+             << ", failed = " << failed.size() << "\n";
+        cout << "(Sort on " << maxThreads << " thread(s), Split = Strategy 2; "
+             << "MB/s relative to the input file)\n";
+        cout.unsetf(ios::floatfield);
+    }
+}
+
+// -----------------------------------------------
+// Grade kernel microbenchmark: Person one by one vs
+// batch kernels (scalar / SSE2 / AVX2) over a StudentTable
+// -----------------------------------------------
+void runGradeKernelBenchmark(const StudentGenerator& generator)
+{
+    cout << "\n======================================\n";
+    cout << "  Average grade kernels (students/second)\n";
+    cout << "======================================\n";
+
+    const size_t n = 1000000;
+    const int repeats = 10;
+
+    StudentTable table = generateStudents<StudentTable>(n, generator);
+
+    vector<Person> people;
+    people.reserve(n);
+    for (size_t row = 0; row < n; ++row) people.push_back(table.toPerson(row));
+
+    // Reference: Person::calculateFinalGradeAverage, one student at a time
+    vector<double> reference(n);
+    double personSec = measureSeconds([&]() {
+        for (int r = 0; r < repeats; ++r)
+            for (size_t i = 0; i < n; ++i)
+            {
+                people[i].calculateFinalGradeAverage();
+                reference[i] = people[i].getFinalGrade();
+            }
+    });
+
+    cout << "\nN = " << n << " students x " << table.homeworkCount()
+         << " homework, " << repeats << " repetitions\n";
+    cout << left << setw(10) << "Person:" << right << fixed << setprecision(0)
+         << setw(14) << n * repeats / personSec << " students/s\n";
+
+    const GradeKernel kernels[] = {KernelScalar, KernelSSE2, KernelAVX2};
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); ++k)
+    {
+        string label = string(gradeKernelName(kernels[k])) + ":";
+        if (!gradeKernelSupported(kernels[k]))
+        {
+            cout << left << setw(10) << label << right << "  not supported on this CPU\n";
+            continue;
+        }
+
+        vector<double> grades(n);
+        double sec = measureSeconds([&]() {
+            for (int r = 0; r < repeats; ++r)
+                calculateFinalGradesAverage(table.homeworkData(), table.examData(), n,
+                                            table.homeworkCount(), &grades[0], kernels[k]);
+        });
+
+        bool identical = memcmp(&grades[0], &reference[0], n * sizeof(double)) == 0;
+        cout << left << setw(10) << label << right << setprecision(0)
+             << setw(14) << n * repeats / sec << " students/s  ("
+             << setprecision(2) << personSec / sec << "x vs Person, "
+             << (identical ? "bit-identical" : "DIFFERENT") << ")\n";
+    }
+    cout << "Runtime choice: " << gradeKernelName(bestGradeKernel()) << "\n";
+    cout.unsetf(ios::floatfield);
+}
+
+// -----------------------------------------------
+// The pre-histogram median (copy + full sort), kept
+// only as the baseline for runMedianBenchmark
+// -----------------------------------------------
+double legacyMedianGrade(const Person& p)
+{
+    const Person::HomeworkScores& hw = p.getHomeworkScores();
+    if (hw.empty()) return 0.6 * p.getExamScore();
+
+    vector<int> sortedScores(hw.begin(), hw.end());
+    sort(sortedScores.begin(), sortedScores.end());
+
+    double median;
+    size_t size = sortedScores.size();
+    if (size % 2 == 0)
+        median = (sortedScores[size / 2 - 1] + sortedScores[size / 2]) / 2.0;
+    else
+        median = sortedScores[size / 2];
+
+    return 0.4 * median + 0.6 * p.getExamScore();
+}
+
+// -----------------------------------------------
+// Median benchmark: copy + sort vs histogram (per Person)
+// vs batched histogram over a StudentTable
+// -----------------------------------------------
+void runMedianBenchmark(const StudentGenerator& generator)
+{
+    cout << "\n======================================\n";
+    cout << "  Median grading (students/second)\n";
+    cout << "======================================\n";
+
+    const size_t n = 200000;
+    const size_t homeworkArray[] = {15, 50, 500};
+    const size_t numCounts = sizeof(homeworkArray) / sizeof(homeworkArray[0]);
+
+    for (size_t idx = 0; idx < numCounts; ++idx)
+    {
+        size_t hwCount = homeworkArray[idx];
+
+        StudentTable table(hwCount);
+        table.reserve(n);
+        vector<uint8_t> hw(hwCount);
+        for (size_t i = 0; i < n; ++i)
         {
-            runTestsForContainer<std::vector<Person> >("std::vector<Person>");
-            runTestsForContainer<std::list<Person> >("std::list<Person>");
-            runTestsForContainer<std::deque<Person> >("std::deque<Person>");
+            StudentGenerator::Stream random = generator.stream(i);
+            for (size_t k = 0; k < hwCount; ++k) hw[k] = static_cast<uint8_t>(random.nextScore());
+            table.addStudent("Name", 4, "Surname", 7, &hw[0],
+                             static_cast<uint8_t>(random.nextScore()));
+        }
+
+        vector<Person> people;
+        people.reserve(n);
+        for (size_t row = 0; row < n; ++row) people.push_back(table.toPerson(row));
+
+        vector<double> legacy(n), histogram(n);
+        double legacySec = measureSeconds([&]() {
+            for (size_t i = 0; i < n; ++i) legacy[i] = legacyMedianGrade(people[i]);
+        });
+        double personSec = measureSeconds([&]() {
+            for (size_t i = 0; i < n; ++i)
+            {
+                people[i].calculateFinalGradeMedian();
+                histogram[i] = people[i].getFinalGrade();
+            }
+        });
+        double batchSec = measureSeconds([&]() {
+            table.calculateFinalGradesMedian();
+        });
+
+        // Fused: average + median + both pass flags in one walk
+        double fusedSec = measureSeconds([&]() {
+            for (size_t i = 0; i < n; ++i) people[i].calculateFinalGrades();
+        });
+
+        bool identical =
+            memcmp(&legacy[0], &histogram[0], n * sizeof(double)) == 0 &&
+            memcmp(&legacy[0], table.finalGradeData(), n * sizeof(double)) == 0;
+        for (size_t i = 0; i < n && identical; ++i)
+            identical = people[i].getFinalGradeMedian() == legacy[i];
+
+        cout << "\n--- " << n << " students x " << hwCount << " homework ---\n";
+        cout << fixed << setprecision(0);
+        cout << "copy + sort:  " << setw(12) << n / legacySec << " students/s\n";
+        cout << "histogram:    " << setw(12) << n / personSec << " students/s  ("
+             << setprecision(2) << legacySec / personSec << "x)\n";
+        cout << setprecision(0);
+        cout << "batched:      " << setw(12) << n / batchSec << " students/s  ("
+             << setprecision(2) << legacySec / batchSec << "x)\n";
+        cout << setprecision(0);
+        cout << "fused avg+med:" << setw(12) << n / fusedSec << " students/s  (both grades)\n";
+        cout << "Results:      " << (identical ? "identical" : "DIFFER") << "\n";
+        cout.unsetf(ios::floatfield);
+    }
+}
+
+// -----------------------------------------------
+// Containers whose nodes and score arrays come from the
+// arena passed to generateArenaStudents (or the heap)
+// -----------------------------------------------
+typedef std::vector<ArenaStudent, ArenaAllocator<ArenaStudent> > ArenaStudentVector;
+typedef std::list<ArenaStudent, ArenaAllocator<ArenaStudent> >   ArenaStudentList;
+typedef std::deque<ArenaStudent, ArenaAllocator<ArenaStudent> >  ArenaStudentDeque;
+
+// -----------------------------------------------
+// One line of the arena comparison
+// -----------------------------------------------
+void printArenaRow(const string& label, long long genTime, long long freeTime,
+                   long peakKb, size_t arenaBytes)
+{
+    cout << left << setw(8) << label << right
+         << "Generate: " << setw(6) << genTime  << " ms   "
+         << "Free: "     << setw(5) << freeTime << " ms   "
+         << "Peak RSS: " << setw(8) << peakKb / 1024 << " MB";
+    if (arenaBytes > 0)
+        cout << "   (arena " << arenaBytes / (1024 * 1024) << " MB)";
+    cout << "\n";
+}
+
+// -----------------------------------------------
+// Heap vs arena generation for one container type.
+// First today's path, generateStudents<PersonContainer>, then
+// the same ArenaStudent code twice; only the arena passed to
+// its allocator differs (NULL = heap).
+// -----------------------------------------------
+template <typename PersonContainer, typename Container>
+void runArenaComparison(const string& containerName,
+                        const StudentGenerator& generator)
+{
+    cout << "\n======================================\n";
+    cout << "  " << containerName << " (Person vs ArenaStudent on heap / arena)\n";
+    cout << "======================================\n";
+
+    const size_t sizesArray[] = {1000000, 10000000};
+    const size_t numSizes = sizeof(sizesArray) / sizeof(sizesArray[0]);
+
+    for (size_t idx = 0; idx < numSizes; ++idx)
+    {
+        size_t n = sizesArray[idx];
+        cout << "\n--- N = " << n << " students ---\n";
+
+        // Person: generateStudents + fillRandomScores, as everywhere else
+        {
+            bool exact = resetPeakRss();
+            long base = currentRssKb();
+
+            PersonContainer students;
+            long long genTime = measureMs([&]() {
+                students = generateStudents<PersonContainer>(n, generator);
+            });
+            long peak = peakRssKb() - (exact ? base : 0);
+
+            long long freeTime = measureMs([&]() {
+                PersonContainer().swap(students);
+            });
+            printArenaRow("Person:", genTime, freeTime, peak, 0);
+        }
+
+        // Heap: every node and score array is its own allocation
+        {
+            bool exact = resetPeakRss();
+            long base = currentRssKb();
+
+            Container students;
+            long long genTime = measureMs([&]() {
+                students = generateArenaStudents<Container>(n, generator, NULL);
+            });
+            long peak = peakRssKb() - (exact ? base : 0);
+
+            long long freeTime = measureMs([&]() {
+                Container().swap(students);
+            });
+            printArenaRow("heap:", genTime, freeTime, peak, 0);
+        }
+
+        // Arena: same code, memory bumped from large chunks and
+        // released in one shot
+        {
+            bool exact = resetPeakRss();
+            long base = currentRssKb();
+
+            MonotonicArena arena;
+
+            Container students;
+            long long genTime = measureMs([&]() {
+                students = generateArenaStudents<Container>(n, generator, &arena);
+            });
+            long peak = peakRssKb() - (exact ? base : 0);
+            size_t arenaBytes = arena.bytesReserved();
+
+            long long freeTime = measureMs([&]() {
+                Container().swap(students);
+                arena.release();
+            });
+            printArenaRow("arena:", genTime, freeTime, peak, arenaBytes);
+        }
+    }
+}
+
+// -----------------------------------------------
+// Generator scaling: same seed, 1..maxThreads threads
+// -----------------------------------------------
+template <typename Container>
+void runGeneratorScaling(const string& containerName, size_t n,
+                         const StudentGenerator& generator, unsigned maxThreads)
+{
+    cout << "\n--- " << containerName << ", N = " << n << " ---\n";
+
+    unsigned long long reference = 0;
+    long long referenceTime = 0;
+
+    vector<unsigned> counts = threadCounts(maxThreads);
+    for (size_t c = 0; c < counts.size(); ++c)
+    {
+        Container students;
+        long long genTime = measureMs([&]() {
+            students = generateStudents<Container>(n, generator, counts[c]);
+        });
+        unsigned long long checksum = datasetChecksum(students);
+        if (c == 0)
+        {
+            reference = checksum;
+            referenceTime = genTime;
+        }
+
+        cout << "Threads " << setw(3) << counts[c] << ":  Generate " << setw(6) << genTime
+             << " ms  speedup " << fixed << setprecision(2)
+             << (genTime > 0 ? double(referenceTime) / genTime : 1.0)
+             << "x  checksum " << hex << checksum << dec
+             << (checksum == reference ? "  (same as 1 thread)" : "  (DIFFERENT)") << "\n";
+        cout.unsetf(ios::floatfield);
+    }
+}
+
+// -----------------------------------------------
+// Writer benchmark: per-field ofstream formatting vs
+// the buffered StudentWriter (passed students only)
+// -----------------------------------------------
+void writeWithOfstream(const vector<Person>& students, const string& filename)
+{
+    ofstream out(filename.c_str());
+    if (!out.is_open())
+    {
+        throw runtime_error("Could not open file for writing: " + filename);
+    }
+
+    writeStudentHeader(out);
+    for (size_t i = 0; i < students.size(); ++i) writeStudentRow(out, students[i]);
+}
+
+bool sameFileContents(const string& a, const string& b)
+{
+    MappedFile first(a);
+    MappedFile second(b);
+    return first.size() == second.size() &&
+           memcmp(first.data(), second.data(), first.size()) == 0;
+}
+
+void runWriterBenchmark(const StudentGenerator& generator)
+{
+    cout << "\n======================================\n";
+    cout << "  Output writer (ofstream vs buffered)\n";
+    cout << "======================================\n";
+    cout << "Seed: " << generator.getSeed() << "\n";
+
+    const size_t sizesArray[] = {100000, 1000000};
+    const size_t numSizes = sizeof(sizesArray) / sizeof(sizesArray[0]);
+
+    for (size_t idx = 0; idx < numSizes; ++idx)
+    {
+        size_t n = sizesArray[idx];
+        vector<Person> passed, failed;
+        {
+            vector<Person> students = generateStudents<vector<Person> >(n, generator);
+            strategy1_splitCopy(students, passed, failed);
+        }
+
+        string streamFile   = "students_" + to_string(n) + "_passed_ofstream.txt";
+        string bufferedFile = "students_" + to_string(n) + "_passed_buffered.txt";
+
+        double streamSec = measureSeconds([&]() {
+            writeWithOfstream(passed, streamFile);
+        });
+        double bufferedSec = measureSeconds([&]() {
+            writeStudentsToFile(passed, bufferedFile);
+        });
+
+        double megabytes = 0.0;
+        {
+            MappedFile probe(bufferedFile);
+            megabytes = probe.size() / (1024.0 * 1024.0);
+        }
+        bool identical = sameFileContents(streamFile, bufferedFile);
+        double rows = static_cast<double>(passed.size());
+
+        cout << "\n--- N = " << n << " (" << passed.size() << " passed, "
+             << fixed << setprecision(1) << megabytes << " MB) ---\n";
+        printLoadRow("ofstream:", streamSec,   megabytes, rows);
+        printLoadRow("buffered:", bufferedSec, megabytes, rows);
+        cout << "Speedup:  " << setprecision(2) << streamSec / bufferedSec
+             << "x, files " << (identical ? "byte-identical" : "DIFFER") << "\n";
+        cout.unsetf(ios::floatfield);
+    }
+}
+
+// -----------------------------------------------
+// Async output benchmark: split + write passed + write failed
+// one after the other vs writer threads fed with batches
+// -----------------------------------------------
+template <typename Container>
+double splitToWriters(const Container& students, size_t batchSize,
+                      AsyncStudentWriter& passedWriter, AsyncStudentWriter& failedWriter)
+{
+    double busy = 0.0;
+    vector<Person> passed, failed;
+    typename Container::const_iterator it = students.begin();
+
+    while (it != students.end())
+    {
+        auto start = chrono::steady_clock::now();
+        passed.reserve(batchSize);
+        failed.reserve(batchSize);
+        for (size_t k = 0; k < batchSize && it != students.end(); ++k, ++it)
+        {
+            if (isPassed(*it)) passed.push_back(*it);
+            else               failed.push_back(*it);
+        }
+        busy += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        // Full batches go out while the split carries on
+        if (!passed.empty()) passedWriter.push(std::move(passed));
+        if (!failed.empty()) failedWriter.push(std::move(failed));
+        passed.clear();
+        failed.clear();
+    }
+    return busy;
+}
+
+void printStageRow(const string& label, double seconds)
+{
+    cout << "  " << left << setw(16) << label << right << fixed << setprecision(1)
+         << setw(9) << seconds * 1000.0 << " ms\n";
+    cout.unsetf(ios::floatfield);
+}
+
+template <typename Container>
+void runAsyncWriteBenchmark(const string& containerName, const StudentGenerator& generator)
+{
+    cout << "\n======================================\n";
+    cout << "  " << containerName << " (sequential vs async writers)\n";
+    cout << "======================================\n";
+    cout << "Seed: " << generator.getSeed() << "\n";
+
+    const size_t sizesArray[] = {100000, 1000000};
+    const size_t numSizes = sizeof(sizesArray) / sizeof(sizesArray[0]);
+    const size_t batchSize = 4096;
+
+    for (size_t idx = 0; idx < numSizes; ++idx)
+    {
+        size_t n = sizesArray[idx];
+        Container students = generateStudents<Container>(n, generator);
+        cout << "\n--- N = " << n << " ---\n";
+
+        string seqPassed   = "students_" + to_string(n) + "_passed_seq.txt";
+        string seqFailed   = "students_" + to_string(n) + "_failed_seq.txt";
+        string asyncPassed = "students_" + to_string(n) + "_passed_async.txt";
+        string asyncFailed = "students_" + to_string(n) + "_failed_async.txt";
+
+        // Sequential: every stage waits for the previous one
+        double splitSec = 0.0, passedSec = 0.0, failedSec = 0.0;
+        Container passed, failed;
+        double seqWall = measureSeconds([&]() {
+            splitSec  = measureSeconds([&]() { strategy1_splitCopy(students, passed, failed); });
+            passedSec = measureSeconds([&]() { writeStudentsToFile(passed, seqPassed); });
+            failedSec = measureSeconds([&]() { writeStudentsToFile(failed, seqFailed); });
+        });
+        Container().swap(passed);
+        Container().swap(failed);
+
+        cout << "Sequential:\n";
+        printStageRow("Split", splitSec);
+        printStageRow("Write passed", passedSec);
+        printStageRow("Write failed", failedSec);
+        printStageRow("Sum of stages", splitSec + passedSec + failedSec);
+        printStageRow("Wall time", seqWall);
+
+        // Sequential over views: the writers read the base container
+        string viewPassed = "students_" + to_string(n) + "_passed_view.txt";
+        string viewFailed = "students_" + to_string(n) + "_failed_view.txt";
+        double viewSplitSec = 0.0, viewPassedSec = 0.0, viewFailedSec = 0.0;
+        double viewWall = measureSeconds([&]() {
+            typename SplitView<Container>::type passedView, failedView;
+            viewSplitSec  = measureSeconds([&]() { strategyView_split(students, passedView, failedView); });
+            viewPassedSec = measureSeconds([&]() { writeStudentsToFile(passedView, viewPassed); });
+            viewFailedSec = measureSeconds([&]() { writeStudentsToFile(failedView, viewFailed); });
+        });
+
+        cout << "Sequential, views (no copies):\n";
+        printStageRow("Split", viewSplitSec);
+        printStageRow("Write passed", viewPassedSec);
+        printStageRow("Write failed", viewFailedSec);
+        printStageRow("Sum of stages", viewSplitSec + viewPassedSec + viewFailedSec);
+        printStageRow("Wall time", viewWall);
+
+        // Async: the split hands batches to two writer threads
+        double asyncSplitSec = 0.0;
+        StageStats passedStats, failedStats;
+        double asyncWall = measureSeconds([&]() {
+            AsyncStudentWriter passedWriter(asyncPassed, "Write passed");
+            AsyncStudentWriter failedWriter(asyncFailed, "Write failed");
+            asyncSplitSec = splitToWriters(students, batchSize, passedWriter, failedWriter);
+            passedWriter.finish();
+            failedWriter.finish();
+            passedStats = passedWriter.stats();
+            failedStats = failedWriter.stats();
+        });
+        double asyncSum = asyncSplitSec + passedStats.busySeconds + failedStats.busySeconds;
+
+        cout << "Async (" << batchSize << "-student batches):\n";
+        printStageRow("Split", asyncSplitSec);
+        printStageRow("Write passed", passedStats.busySeconds);
+        printStageRow("Write failed", failedStats.busySeconds);
+        printStageRow("Sum of stages", asyncSum);
+        printStageRow("Wall time", asyncWall);
+
+        bool identical = sameFileContents(seqPassed, asyncPassed) &&
+                         sameFileContents(seqFailed, asyncFailed) &&
+                         sameFileContents(seqPassed, viewPassed) &&
+                         sameFileContents(seqFailed, viewFailed);
+        cout << "Overlap: " << fixed << setprecision(2)
+             << (asyncWall > 0 ? asyncSum / asyncWall : 1.0) << "x stage time per wall second, "
+             << "wall speedup " << (asyncWall > 0 ? seqWall / asyncWall : 1.0) << "x, files "
+             << (identical ? "identical" : "DIFFER") << "\n";
+        cout.unsetf(ios::floatfield);
+    }
+}
+
+// -----------------------------------------------
+// Snapshot benchmark: text readers vs binary snapshot load
+// -----------------------------------------------
+double fileMegabytes(const string& filename)
+{
+    MappedFile probe(filename);
+    return probe.size() / (1024.0 * 1024.0);
+}
+
+void runSnapshotBenchmark(const string& source)
+{
+    cout << "\n======================================\n";
+    cout << "  Text file vs binary snapshot\n";
+    cout << "======================================\n";
+
+    const size_t scalesArray[] = {1, 10, 100};
+    const size_t numScales = sizeof(scalesArray) / sizeof(scalesArray[0]);
+
+    for (size_t idx = 0; idx < numScales; ++idx)
+    {
+        size_t copies = scalesArray[idx];
+        string scaled = "students_scaled_x" + to_string(copies) + ".txt";
+        string snapshot = "students_scaled_x" + to_string(copies) + ".snap";
+        writeScaledFile(source, scaled, copies);
+
+        vector<Person> text;
+        double textSec = measureSeconds([&]() {
+            text = readFromFile(scaled);
+        });
+        double saveSec = measureSeconds([&]() {
+            saveSnapshot(text, snapshot);
+        });
+
+        vector<Person> loaded;
+        double openSec = measureSeconds([&]() {
+            StudentSnapshot view(snapshot);
+        });
+        double tableSec = measureSeconds([&]() {
+            StudentTable table = loadSnapshotTable(snapshot);
+        });
+        double personSec = measureSeconds([&]() {
+            loaded = loadSnapshot(snapshot);
+        });
+
+        double rows = static_cast<double>(text.size());
+        double textMb = fileMegabytes(scaled);
+        double snapMb = fileMegabytes(snapshot);
+        bool identical = sameStudents(text, loaded);
+
+        cout << "\n--- " << scaled << " (" << text.size() << " rows, "
+             << fixed << setprecision(1) << textMb << " MB text, "
+             << snapMb << " MB snapshot) ---\n";
+        printLoadRow("getline:",  textSec,   textMb, rows);
+        printLoadRow("save:",     saveSec,   snapMb, rows);
+        printLoadRow("mmap view:", openSec,  snapMb, rows);
+        printLoadRow("-> table:", tableSec,  snapMb, rows);
+        printLoadRow("-> Person:", personSec, snapMb, rows);
+        cout << "Speedup (vector<Person>): " << setprecision(2) << textSec / personSec
+             << "x, round trip " << (identical ? "identical" : "DIFFERS") << "\n";
+        cout.unsetf(ios::floatfield);
+    }
+}
+
+// -----------------------------------------------
+// Sort benchmark: single-threaded sort vs sortStudents
+// on 1..maxThreads threads
+// -----------------------------------------------
+template <typename Container>
+bool sameOrder(const Container& a, const Container& b)
+{
+    return a.size() == b.size() &&
+           equal(a.begin(), a.end(), b.begin(), [](const Person& x, const Person& y) {
+               return x.getFirstName() == y.getFirstName() &&
+                      x.getSurname() == y.getSurname() &&
+                      x.getHomeworkScores() == y.getHomeworkScores() &&
+                      x.getExamScore() == y.getExamScore();
+           });
+}
+
+template <typename T, typename A>
+void referenceSort(std::list<T, A>& students)
+{
+    students.sort();
+}
+
+template <typename Container>
+void referenceSort(Container& students)
+{
+    stable_sort(students.begin(), students.end());
+}
+
+template <typename Container>
+void runSortScaling(const string& containerName, size_t n,
+                    const StudentGenerator& generator, unsigned maxThreads)
+{
+    cout << "\n--- " << containerName << ", N = " << n << " ---\n";
+
+    const Container original = generateStudents<Container>(n, generator);
+
+    Container reference = original;
+    double referenceSec = measureSeconds([&]() {
+        referenceSort(reference);
+    });
+    cout << "Single-threaded sort:  " << fixed << setprecision(1)
+         << referenceSec * 1000.0 << " ms\n";
+
+    vector<unsigned> counts = threadCounts(maxThreads);
+    for (size_t c = 0; c < counts.size(); ++c)
+    {
+        Container students = original;
+        double sortSec = measureSeconds([&]() {
+            sortStudents(students, counts[c]);
+        });
+
+        cout << "Threads " << setw(3) << counts[c] << ":  " << setw(8) << sortSec * 1000.0
+             << " ms  speedup " << setprecision(2) << referenceSec / sortSec << "x  "
+             << (sameOrder(students, reference) ? "(same order)" : "(DIFFERENT ORDER)") << "\n";
+        cout << setprecision(1);
+    }
+    cout.unsetf(ios::floatfield);
+}
+
+// -----------------------------------------------
+// Radix benchmark: comparison sort (std::sort / list::sort)
+// vs the key-prefix radix sort, single-threaded
+// -----------------------------------------------
+template <typename T, typename A>
+void comparisonSort(std::list<T, A>& students)
+{
+    students.sort();
+}
+
+void comparisonSort(StudentTable& students)
+{
+    sortStudents(students, SortComparison);
+}
+
+template <typename Container>
+void comparisonSort(Container& students)
+{
+    sort(students.begin(), students.end());
+}
+
+template <typename Container>
+void runRadixSortComparison(const string& containerName, size_t n,
+                            const StudentGenerator& generator)
+{
+    const Container original = generateStudents<Container>(n, generator);
+
+    Container byCompare = original;
+    double compareSec = measureSeconds([&]() {
+        comparisonSort(byCompare);
+    });
+
+    Container byRadix = original;
+    double radixSec = measureSeconds([&]() {
+        sortStudents(byRadix, SortKeyRadix);
+    });
+
+    bool same = datasetChecksum(byCompare) == datasetChecksum(byRadix);
+    cout << left << setw(22) << containerName << right << fixed << setprecision(1)
+         << setw(10) << compareSec * 1000.0 << " ms"
+         << setw(10) << radixSec * 1000.0 << " ms"
+         << setprecision(2) << setw(9) << compareSec / radixSec << "x  "
+         << (same ? "(same order)" : "(DIFFERENT ORDER)") << "\n";
+    cout.unsetf(ios::floatfield);
+}
+
+// -----------------------------------------------
+// Natural order benchmark: today's lexicographic sort vs
+// natural order from precomputed keys (and computed per compare)
+// -----------------------------------------------
+bool naturalLessOnTheFly(const Person& a, const Person& b)
+{
+    int bySurname = naturalCompare(a.getSurname().data(), a.getSurname().size(),
+                                   b.getSurname().data(), b.getSurname().size());
+    if (bySurname != 0) return bySurname < 0;
+    int byName = naturalCompare(a.getFirstName().data(), a.getFirstName().size(),
+                                b.getFirstName().data(), b.getFirstName().size());
+    if (byName != 0) return byName < 0;
+    return a < b;
+}
+
+void printFirstSurnames(const string& label, const vector<Person>& students)
+{
+    cout << left << setw(16) << label << right;
+    for (size_t i = 0; i < students.size() && i < 5; ++i) cout << " " << students[i].getSurname();
+    cout << "\n";
+}
+
+void runNaturalSortBenchmark(size_t n, const StudentGenerator& generator)
+{
+    cout << "\nSeed: " << generator.getSeed() << ", N = " << n << "\n\n";
+
+    // Generated students are already in natural order; shuffle
+    // (same permutation for every variant) so no sort gets it for free
+    vector<Person> original = generateStudents<vector<Person> >(n, generator);
+    shuffle(original.begin(), original.end(), mt19937_64(generator.getSeed()));
+
+    vector<Person> lexicographic = original;
+    double lexSec = measureSeconds([&]() {
+        sort(lexicographic.begin(), lexicographic.end());
+    });
+
+    // Keys are built once, like at load time
+    vector<Person> keyed = original;
+    double keySec = measureSeconds([&]() {
+        buildNaturalKeys(keyed);
+    });
+
+    vector<Person> byKeyCompare = keyed;
+    double keyCompareSec = measureSeconds([&]() {
+        sort(byKeyCompare.begin(), byKeyCompare.end(), NaturalLess());
+    });
+
+    vector<Person> byKeyRadix = keyed;
+    double keyRadixSec = measureSeconds([&]() {
+        sortStudents(byKeyRadix, SortNatural);
+    });
+
+    vector<Person> onTheFly = original;
+    double onTheFlySec = measureSeconds([&]() {
+        sort(onTheFly.begin(), onTheFly.end(), naturalLessOnTheFly);
+    });
+
+    cout << fixed << setprecision(1);
+    cout << "Lexicographic std::sort:        " << setw(9) << lexSec * 1000.0 << " ms\n";
+    cout << "Natural keys (built once):      " << setw(9) << keySec * 1000.0 << " ms\n";
+    cout << "Natural, std::sort on keys:     " << setw(9) << keyCompareSec * 1000.0 << " ms\n";
+    cout << "Natural, radix on keys:         " << setw(9) << keyRadixSec * 1000.0 << " ms\n";
+    cout << "Natural, parsed per compare:    " << setw(9) << onTheFlySec * 1000.0 << " ms\n";
+    cout.unsetf(ios::floatfield);
+
+    unsigned long long reference = datasetChecksum(onTheFly);
+    bool same = datasetChecksum(byKeyCompare) == reference &&
+                datasetChecksum(byKeyRadix) == reference;
+    cout << "Natural orders " << (same ? "identical" : "DIFFER") << "\n\n";
+
+    printFirstSurnames("Lexicographic:", lexicographic);
+    printFirstSurnames("Natural:", byKeyRadix);
+}
+
+// -----------------------------------------------
+// Parallel split benchmark: Strategy 3 on one thread
+// vs parallelSplitCopy on 1..N threads
+// -----------------------------------------------
+template <typename Container>
+void runSplitScaling(const string& containerName, size_t n,
+                     const StudentGenerator& generator, unsigned maxThreads)
+{
+    cout << "\n--- " << containerName << ", N = " << n << " ---\n";
+
+    const Container students = generateStudents<Container>(n, generator);
+
+    Container passed, failed;
+    double referenceSec = measureSeconds([&]() {
+        strategy3_splitOnePass(students, passed, failed);
+    });
+    cout << "Strategy 3 (serial):  " << fixed << setprecision(1)
+         << referenceSec * 1000.0 << " ms  passed = " << passed.size()
+         << ", failed = " << failed.size() << "\n";
+
+    vector<unsigned> counts = threadCounts(maxThreads);
+    for (size_t c = 0; c < counts.size(); ++c)
+    {
+        Container parallelPassed, parallelFailed;
+        double splitSec = measureSeconds([&]() {
+            parallelSplitCopy(students, parallelPassed, parallelFailed, isPassed, counts[c]);
+        });
+
+        bool same = sameOrder(parallelPassed, passed) && sameOrder(parallelFailed, failed);
+        cout << "Threads " << setw(3) << counts[c] << ":  " << setw(8) << splitSec * 1000.0
+             << " ms  speedup " << setprecision(2) << referenceSec / splitSec << "x  "
+             << (same ? "(same split)" : "(DIFFERENT SPLIT)") << "\n";
+        cout << setprecision(1);
+    }
+    cout.unsetf(ios::floatfield);
+}
+
+// -----------------------------------------------
+// Streaming pipeline report: per-stage throughput,
+// wall time and peak memory
+// -----------------------------------------------
+void printPipelineResult(const PipelineResult& result, long peakKb)
+{
+    cout << "\n" << left << setw(16) << "Stage" << right << setw(12) << "Students"
+         << setw(12) << "Busy (s)" << setw(16) << "Students/s" << "\n";
+    cout << string(56, '-') << "\n";
+    for (size_t i = 0; i < result.stages.size(); ++i)
+    {
+        const StageStats& stage = result.stages[i];
+        cout << left << setw(16) << stage.name << right << setw(12) << stage.students
+             << fixed << setprecision(3) << setw(12) << stage.busySeconds
+             << setprecision(0) << setw(16)
+             << (stage.busySeconds > 0 ? stage.students / stage.busySeconds : 0.0) << "\n";
+    }
+    cout.unsetf(ios::floatfield);
+
+    cout << "\nPassed: " << result.passed << "  Failed: " << result.failed << "\n";
+    cout << "Wall time: " << fixed << setprecision(3) << result.wallSeconds << " s ("
+         << setprecision(0)
+         << (result.wallSeconds > 0 ? (result.passed + result.failed) / result.wallSeconds : 0.0)
+         << " students/s)\n";
+    cout.unsetf(ios::floatfield);
+    cout << "Peak RSS: " << peakKb / 1024 << " MB\n";
+}
+
+void runStreamingPipeline(const StudentGenerator& generator)
+{
+    string source;
+    size_t n = 0;
+    PipelineOptions options;
+    cout << "Input file (- = generate): ";
+    cin >> source;
+    if (source == "-")
+    {
+        cout << "How many students? ";
+        cin >> n;
+    }
+    cout << "Batch size (0 = " << options.batchSize << "): ";
+    size_t batchSize = 0;
+    cin >> batchSize;
+    if (batchSize > 0) options.batchSize = batchSize;
+
+    string tag = source == "-" ? to_string(n) : "file";
+    string passedFile = "students_" + tag + "_passed_stream.txt";
+    string failedFile = "students_" + tag + "_failed_stream.txt";
+
+    if (source == "-") cout << "\nSeed: " << generator.getSeed() << " ";
+    else cout << "\nInput: " << source << " ";
+    cout << " batch: " << options.batchSize
+         << "  queue: " << options.queueCapacity << " batches\n";
+
+    bool exact = resetPeakRss();
+    long base = currentRssKb();
+    PipelineResult result = source == "-"
+        ? runGeneratePipeline(n, generator, passedFile, failedFile, options)
+        : runFilePipeline(source, passedFile, failedFile, options);
+    long peak = peakRssKb() - (exact ? base : 0);
+
+    printPipelineResult(result, peak);
+    cout << "Output: " << passedFile << ", " << failedFile << "\n";
+}
+
+// -----------------------------------------------
+// Command-line mode: every (N, stage, container) cell is
+// run "reps" times and printed as one CSV / JSON row
+// -----------------------------------------------
+template <typename Container>
+void strategyParallel_split(const Container& students, Container& passed,
+                            Container& failed, unsigned threads)
+{
+    passed.clear();
+    failed.clear();
+    parallelSplitCopy(students, passed, failed, isPassed, threads);
+}
+
+template <typename Container>
+bool hasStrategy(const string&)
+{
+    return true;
+}
+
+// No parallel split for the columnar table
+template <>
+bool hasStrategy<StudentTable>(const string& strategy)
+{
+    return strategy != "parallel";
+}
+
+template <>
+void strategyParallel_split<StudentTable>(const StudentTable&, StudentTable&,
+                                          StudentTable&, unsigned)
+{
+    throw runtime_error("parallel split is not available for StudentTable");
+}
+
+// Benchmark one strategy on "students" (left unchanged)
+template <typename Container>
+BenchmarkStats benchmarkStrategy(const string& strategy, const Container& students,
+                                 unsigned threads, const BenchmarkOptions& bench,
+                                 size_t& passedCount, size_t& failedCount)
+{
+    BenchmarkStats stats;
+    if (strategy == "2")
+    {
+        Container base, failed;        // Strategy 2 changes its input
+        stats = runBenchmark(bench,
+            [&]() { base = students; failed = Container(); },
+            [&]() { strategy2_moveFailed(base, failed); });
+        passedCount = base.size();
+        failedCount = failed.size();
+    }
+    else if (strategy == "view")
+    {
+        typedef typename SplitView<Container>::type View;
+        View passed, failed;
+        stats = runBenchmark(bench,
+            [&]() { passed = View(); failed = View(); },
+            [&]() {
+                strategyView_split(students, passed, failed);
+                doNotOptimize(passed);
+                doNotOptimize(failed);
+            });
+        passedCount = passed.size();
+        failedCount = failed.size();
+    }
+    else
+    {
+        Container passed, failed;
+        stats = runBenchmark(bench,
+            [&]() { passed = Container(); failed = Container(); },
+            [&]() {
+                if (strategy == "1")      strategy1_splitCopy(students, passed, failed);
+                else if (strategy == "3") strategy3_splitOnePass(students, passed, failed);
+                else                      strategyParallel_split(students, passed, failed, threads);
+            });
+        passedCount = passed.size();
+        failedCount = failed.size();
+    }
+    return stats;
+}
+
+template <typename Container>
+void runCommandLineCells(const string& containerName, const CommandLineOptions& options,
+                         const StudentGenerator& generator, vector<BenchmarkRow>& rows)
+{
+    vector<string> strategies;
+    for (size_t s = 0; s < options.strategies.size(); ++s)
+    {
+        if (hasStrategy<Container>(options.strategies[s])) strategies.push_back(options.strategies[s]);
+        else cerr << "note: strategy " << options.strategies[s] << " skipped for " << containerName << "\n";
+    }
+
+    BenchmarkOptions bench(options.warmup, options.reps, options.pinCpu);
+    for (size_t idx = 0; idx < options.sizes.size(); ++idx)
+    {
+        size_t n = options.sizes[idx];
+
+        // The last generate trial is the input of every strategy
+        Container students;
+        BenchmarkStats generateStats = runBenchmark(bench,
+            [&]() { students = Container(); },
+            [&]() { students = generateStudents<Container>(n, generator, options.threads); });
+        BenchmarkRow row = {n, "generate", containerName, generateStats, 0, 0};
+        rows.push_back(row);
+
+        for (size_t s = 0; s < strategies.size(); ++s)
+        {
+            string stage = strategies[s] == "view" || strategies[s] == "parallel"
+                         ? strategies[s] : "strategy" + strategies[s];
+            BenchmarkRow strategyRow = {n, stage, containerName, BenchmarkStats(), 0, 0};
+            strategyRow.time = benchmarkStrategy(strategies[s], students, options.threads, bench,
+                                                 strategyRow.passed, strategyRow.failed);
+            rows.push_back(strategyRow);
+        }
+    }
+}
+
+int runCommandLine(int argc, char* argv[])
+{
+    CommandLineOptions options;
+    try
+    {
+        options = parseCommandLine(argc, argv);
+    }
+    catch (const std::exception& ex)
+    {
+        cerr << "ERROR: " << ex.what() << "\n\n";
+        printUsage(cerr, argv[0]);
+        return 2;
+    }
+    if (options.help)
+    {
+        printUsage(cout, argv[0]);
+        return 0;
+    }
+
+    if (options.seed == 0) options.seed = randomSeed();
+    StudentGenerator generator(options.seed);
+
+    vector<BenchmarkRow> rows;
+    try
+    {
+        for (size_t c = 0; c < options.containers.size(); ++c)
+        {
+            const string& name = options.containers[c];
+            if (name == "vector")     runCommandLineCells<std::vector<Person> >(name, options, generator, rows);
+            else if (name == "list")  runCommandLineCells<std::list<Person> >(name, options, generator, rows);
+            else if (name == "deque") runCommandLineCells<std::deque<Person> >(name, options, generator, rows);
+            else                      runCommandLineCells<StudentTable>(name, options, generator, rows);
+        }
+    }
+    catch (const std::exception& ex)
+    {
+        cerr << "ERROR: " << ex.what() << "\n";
+        return 1;
+    }
+
+    if (options.format == "json")
+    {
+        writeRowsJson(cout, options, rows);
+    }
+    else
+    {
+        cerr << "seed: " << options.seed << "\n";   // keeps stdout plain CSV
+        writeRowsCsv(cout, rows);
+    }
+    return 0;
+}
+
+// -----------------------------------------------
+// Main menu for v1.0
+// -----------------------------------------------
+int main(int argc, char* argv[])
+{
+    // Any argument selects the scriptable mode; no menu, no pause
+    if (argc > 1) return runCommandLine(argc, argv);
+
+    setupConsole();
+
+    cout << "=== STUDENT GRADING SYSTEM - v1.0 ===\n\n";
+    cout << "This version compares three splitting strategies and views\n";
+    cout << "for three containers: std::vector, std::list, std::deque\n";
+    cout << "(plus the columnar StudentTable).\n\n";
+    cout << "1. Test std::vector\n";
+    cout << "2. Test std::list\n";
+    cout << "3. Test std::deque\n";
+    cout << "4. Test ALL containers\n";
+    cout << "5. Benchmark file loading (getline vs memory-mapped)\n";
+    cout << "6. Test StudentTable (struct-of-arrays)\n";
+    cout << "7. Benchmark average grade kernels (scalar / SSE2 / AVX2)\n";
+    cout << "8. Benchmark median grading (sort vs histogram)\n";
+    cout << "9. Compare heap vs arena generation (1M / 10M)\n";
+    cout << "10. Generate with a fixed seed on 1..N threads\n";
+    cout << "11. Streaming pipeline (generate -> grade -> split -> write)\n";
+    cout << "12. Benchmark output writer (ofstream vs buffered)\n";
+    cout << "13. Benchmark sequential vs async passed/failed writers\n";
+    cout << "14. Benchmark binary snapshot load vs text file\n";
+    cout << "15. Benchmark parallel sort on 1..N threads\n";
+    cout << "16. Benchmark key-prefix radix sort vs comparison sort\n";
+    cout << "17. Benchmark natural (numeric-aware) name order\n";
+    cout << "18. Benchmark parallel passed/failed split on 1..N threads\n";
+    cout << "Choice: ";
+    cout.flush();   // make sure the prompt appears
+
+    int choice = 0;
+    if (!(cin >> choice))
+    {
+        cerr << "Invalid input. Exiting.\n";
+        return 0;
+    }
+
+    // Fresh seed every run; it is printed so a run can be repeated
+    StudentGenerator generator(randomSeed());
+
+    try
+    {
+        if (choice == 1)
+        {
+            runTestsForContainer<std::vector<Person> >("std::vector<Person>", generator);
+        }
+        else if (choice == 2)
+        {
+            runTestsForContainer<std::list<Person> >("std::list<Person>", generator);
+        }
+        else if (choice == 3)
+        {
+            runTestsForContainer<std::deque<Person> >("std::deque<Person>", generator);
+        }
+        else if (choice == 4)
+        {
+            runTestsForContainer<std::vector<Person> >("std::vector<Person>", generator);
+            runTestsForContainer<std::list<Person> >("std::list<Person>", generator);
+            runTestsForContainer<std::deque<Person> >("std::deque<Person>", generator);
+            runTestsForContainer<StudentTable>("StudentTable (SoA)", generator);
+        }
+        else if (choice == 5)
+        {
+            string source;
+            cout << "Source file (e.g. ../v0.1/students10000.txt): ";
+            cin >> source;
+
+            unsigned maxThreads = 0;
+            cout << "Max threads (0 = all cores): ";
+            cin >> maxThreads;
+            if (maxThreads == 0) maxThreads = thread::hardware_concurrency();
+            if (maxThreads == 0) maxThreads = 1;
+
+            runLoaderBenchmark(source, maxThreads);
+        }
+        else if (choice == 6)
+        {
+            runTestsForContainer<StudentTable>("StudentTable (SoA)", generator);
+        }
+        else if (choice == 7)
+        {
+            runGradeKernelBenchmark(generator);
+        }
+        else if (choice == 8)
+        {
+            runMedianBenchmark(generator);
+        }
+        else if (choice == 9)
+        {
+            int container = 0;
+            cout << "Container (1 = vector, 2 = list, 3 = deque, 4 = all): ";
+            cin >> container;
+
+            if (container == 1 || container == 4)
+                runArenaComparison<std::vector<Person>, ArenaStudentVector>("std::vector", generator);
+            if (container == 2 || container == 4)
+                runArenaComparison<std::list<Person>, ArenaStudentList>("std::list", generator);
+            if (container == 3 || container == 4)
+                runArenaComparison<std::deque<Person>, ArenaStudentDeque>("std::deque", generator);
+        }
+        else if (choice == 10)
+        {
+            size_t n = 0;
+            unsigned long long seed = 0;
+            unsigned maxThreads = 0;
+            cout << "How many students? ";
+            cin >> n;
+            cout << "Seed (0 = random): ";
+            cin >> seed;
+            cout << "Max threads (0 = all cores): ";
+            cin >> maxThreads;
+            if (maxThreads == 0) maxThreads = thread::hardware_concurrency();
+            if (maxThreads == 0) maxThreads = 1;
+
+            StudentGenerator seeded(seed != 0 ? seed : randomSeed());
+            cout << "\nSeed: " << seeded.getSeed() << "\n";
+            runGeneratorScaling<std::vector<Person> >("std::vector<Person>", n, seeded, maxThreads);
+            runGeneratorScaling<std::list<Person> >("std::list<Person>", n, seeded, maxThreads);
+            runGeneratorScaling<StudentTable>("StudentTable (SoA)", n, seeded, maxThreads);
+        }
+        else if (choice == 11)
+        {
+            runStreamingPipeline(generator);
+        }
+        else if (choice == 12)
+        {
+            runWriterBenchmark(generator);
+        }
+        else if (choice == 13)
+        {
+            int container = 0;
+            cout << "Container (1 = vector, 2 = list, 3 = deque, 4 = all): ";
+            cin >> container;
+
+            if (container == 1 || container == 4)
+                runAsyncWriteBenchmark<std::vector<Person> >("std::vector<Person>", generator);
+            if (container == 2 || container == 4)
+                runAsyncWriteBenchmark<std::list<Person> >("std::list<Person>", generator);
+            if (container == 3 || container == 4)
+                runAsyncWriteBenchmark<std::deque<Person> >("std::deque<Person>", generator);
+        }
+        else if (choice == 14)
+        {
+            string source;
+            cout << "Source file (e.g. ../v0.1/students10000.txt): ";
+            cin >> source;
+            runSnapshotBenchmark(source);
+        }
+        else if (choice == 15)
+        {
+            size_t n = 0;
+            unsigned maxThreads = 0;
+            cout << "How many students? ";
+            cin >> n;
+            cout << "Max threads (0 = all cores): ";
+            cin >> maxThreads;
+            if (maxThreads == 0) maxThreads = thread::hardware_concurrency();
+            if (maxThreads == 0) maxThreads = 1;
+
+            cout << "\nSeed: " << generator.getSeed() << "\n";
+            runSortScaling<std::vector<Person> >("std::vector<Person>", n, generator, maxThreads);
+            runSortScaling<std::deque<Person> >("std::deque<Person>", n, generator, maxThreads);
+            runSortScaling<std::list<Person> >("std::list<Person>", n, generator, maxThreads);
+        }
+        else if (choice == 16)
+        {
+            size_t n = 0;
+            cout << "How many students? ";
+            cin >> n;
+
+            cout << "\nSeed: " << generator.getSeed() << ", N = " << n << "\n";
+            cout << left << setw(22) << "Container" << right << setw(13) << "compare"
+                 << setw(13) << "radix" << setw(10) << "speedup" << "\n";
+            runRadixSortComparison<std::vector<Person> >("std::vector<Person>", n, generator);
+            runRadixSortComparison<std::deque<Person> >("std::deque<Person>", n, generator);
+            runRadixSortComparison<std::list<Person> >("std::list<Person>", n, generator);
+            runRadixSortComparison<StudentTable>("StudentTable (SoA)", n, generator);
+        }
+        else if (choice == 17)
+        {
+            size_t n = 0;
+            cout << "How many students? ";
+            cin >> n;
+            runNaturalSortBenchmark(n, generator);
+        }
+        else if (choice == 18)
+        {
+            size_t n = 0;
+            unsigned maxThreads = 0;
+            cout << "How many students? ";
+            cin >> n;
+            cout << "Max threads (0 = all cores): ";
+            cin >> maxThreads;
+            if (maxThreads == 0) maxThreads = thread::hardware_concurrency();
+            if (maxThreads == 0) maxThreads = 1;
+
+            cout << "\nSeed: " << generator.getSeed() << "\n";
+            runSplitScaling<std::vector<Person> >("std::vector<Person>", n, generator, maxThreads);
+            runSplitScaling<std::deque<Person> >("std::deque<Person>", n, generator, maxThreads);
+            runSplitScaling<std::list<Person> >("std::list<Person>", n, generator, maxThreads);
         }
         else
         {